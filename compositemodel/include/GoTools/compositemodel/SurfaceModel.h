@@ -57,6 +57,7 @@
 #include "GoTools/compositemodel/ftLine.h"
 #include "GoTools/compositemodel/FaceUtilities.h"
 #include <vector>
+#include <set>
 
 namespace Go
 {
@@ -69,6 +70,9 @@ namespace Go
  class IntResultsSfModel;
  class Loop;
  class Body;
+ class Vertex;
+ class GenericTriMesh;
+ class CompactTriMesh;
  struct SamplePointData;
 
 //===========================================================================
@@ -521,6 +525,63 @@ class GO_API SurfaceModel : public CompositeModel
   /// \param face Pointer to the face
   void updateFaceTopology(shared_ptr<ftSurface> face);
 
+  /// Register that a face is modified. The modifications are collected
+  /// until clearModifications() is called, and make it possible to
+  /// update results computed from the model, like quality checks,
+  /// for the affected faces only. Operations in this class register
+  /// their modifications, and operations rebuilding the topology of
+  /// the complete model register the entire model as modified.
+  /// Modifications made directly to the faces, edges or vertices are
+  /// not seen by the model and must be registered by the application.
+  /// Faces not belonging to the model are ignored.
+  /// \param face Pointer to the modified face
+  /// \param include_neighbours If true, the current neighbours of the face
+  ///        are registered as well. Used when the adjacency is changed.
+  void markModified(ftSurface* face, bool include_neighbours = false);
+
+  /// Register that an edge is modified. The faces on both sides of the
+  /// edge are registered.
+  /// \param edge Pointer to the modified edge
+  void markModified(ftEdgeBase* edge);
+
+  /// Register that a vertex is moved or merged with another vertex.
+  /// All faces meeting in the vertex are registered.
+  /// \param vertex Pointer to the modified vertex
+  void markModified(Vertex* vertex);
+
+  /// Register that several vertices are moved or merged. The faces
+  /// meeting in the vertices are collected before the faces of the
+  /// model are traversed, thus this is cheaper than registering the
+  /// vertices one by one.
+  /// \param vertices Pointers to the modified vertices
+  void markModified(const std::vector<Vertex*>& vertices);
+
+  /// Register that the entire model is modified
+  void markAllModified();
+
+  /// Check if any modifications are registered
+  bool isModified() const
+  {
+    return (all_modified_ || modified_faces_.size() > 0);
+  }
+
+  /// Faces affected by the registered modifications, in the order of
+  /// the faces in the model. Removed faces are not included.
+  /// \param faces The affected faces
+  /// \param include_neighbours If true, the neighbours of the affected
+  ///        faces are included
+  /// \return False if the entire model is modified. The affected
+  ///         faces are not computed in that case.
+  bool getModifiedFaces(std::vector<shared_ptr<ftSurface> >& faces,
+			bool include_neighbours = true) const;
+
+  /// Forget the registered modifications
+  void clearModifications()
+  {
+    modified_faces_.clear();
+    all_modified_ = false;
+  }
+
 /*   // Join a new surface to an existing surface in the surface set. */
 /*   // An update of the topology structure is performed. */
 /*   // This function makes sense only in some combination of input. */
@@ -582,6 +643,17 @@ class GO_API SurfaceModel : public CompositeModel
 /*   // virtual void draw(/\* Some appropriate parameter list *\/) const; */
 /*   virtual void draw() const { } */
 
+  /// Tesselate faces in parallel threads. Only active if GoTools is
+  /// compiled with OpenMP. Each face is tesselated on a copy of its
+  /// surface, thus faces sharing geometry may be handled at the same
+  /// time. The resulting meshes are identical to the meshes produced
+  /// by the sequential tesselation.
+  /// \param multi_core Whether or not the tesselation is run in parallel
+  void setMultiCore(bool multi_core)
+  {
+    multi_core_ = multi_core;
+  }
+
   /// Tesselate surface model
   /// Tesselate all surfaces with respect to a default resolution
   /// \retval meshes Tesselated model
@@ -635,6 +707,36 @@ class GO_API SurfaceModel : public CompositeModel
 		 double density,
 		 std::vector<shared_ptr<GeneralMesh> >& meshes) const;
 
+  /// Tesselate all surfaces with respect to a given tesselation density
+  /// into one compact mesh with single precision vertices and 32 bit
+  /// indices. Vertices closer than weld_tol are shared between faces.
+  /// The faces are processed in batches, so the double precision face
+  /// meshes are never held for the entire model at once.
+  /// \param density Tesselation density
+  /// \param weld_tol Tolerance for merging vertices, no merging if zero
+  /// \return Tesselated model
+  shared_ptr<CompactTriMesh> tesselateCompact(double density,
+					      double weld_tol) const;
+
+  /// Tesselate all surfaces with respect to a given tesselation density
+  /// and stream the triangles to binary STL. Only one batch of faces is
+  /// held in memory at a time.
+  /// \param os Output stream, must be seekable (for instance a file)
+  /// \param density Tesselation density
+  void writeTesselationSTL(std::ostream& os, double density) const;
+
+  /// Tolerance driven tesselation of all faces into one triangle mesh.
+  /// Adjacent faces share the vertices along common edges, so the
+  /// resulting mesh has no cracks between faces. Along sharp edges the
+  /// vertices are duplicated at identical positions to keep the normals
+  /// of each side. A face that cannot be tesselated leaves a hole, use
+  /// SurfaceModelTesselator directly to get the failed faces.
+  /// \param chord_tol Maximum distance between the triangles and the surfaces
+  /// \param ang_tol Maximum angle between surface normals in a triangle edge
+  /// \return Tesselated model
+  shared_ptr<GenericTriMesh> tesselateWatertight(double chord_tol,
+						 double ang_tol) const;
+
   /// Return a tesselation of the control polygon of all surfaces
   /// \retval ctr_pol Tesselation of the control polygon of all surfaces.
   virtual 
@@ -872,6 +974,7 @@ class GO_API SurfaceModel : public CompositeModel
 
   double approxtol_;
   double tol2d_;  // Tolerance to use for decisions in the parameter domain
+  bool multi_core_;  // Tesselate faces in parallel
 
   // Engine for the topology analysis
   //tpTopologyTable<ftEdgeBase, ftFaceBase> top_table_;
@@ -893,8 +996,30 @@ class GO_API SurfaceModel : public CompositeModel
 
   std::vector<std::pair<ftFaceBase*, ftFaceBase*> > inconsistent_orientation_;
 
+  // Faces affected by modifications since the last call to
+  // clearModifications(). Modified edges and vertices are registered
+  // through their faces. The faces are kept alive by the shared
+  // pointers, thus their addresses are not reused by new faces.
+  std::set<shared_ptr<ftSurface> > modified_faces_;
+  bool all_modified_;  // The entire model is modified
+
+  // Register the faces of the model found in the given set
+  void markModified(const std::set<ftSurface*>& faces);
+
   void addSegment(ftCurve& cv, ftEdgeBase* edge, ftCurveType ty);
 
+  // Tesselation resolution of each face from a tesselation density
+  void resolutionFromDensity(const std::vector<shared_ptr<ftFaceBase> >& faces,
+			     double density, std::vector<int>& u_res,
+			     std::vector<int>& v_res) const;
+
+  // Tesselate faces with given resolutions. Used by the tesselate
+  // functions after the resolutions are computed
+  void tesselateFaces(const std::vector<shared_ptr<ftFaceBase> >& faces,
+		      const std::vector<int>& u_res,
+		      const std::vector<int>& v_res,
+		      std::vector<shared_ptr<GeneralMesh> >& meshes) const;
+
  private:
 
   void getCurveofType(ftCurveType type, ftCurve& curve);
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SURFACEMODELTESSELATOR_H
+#define _SURFACEMODELTESSELATOR_H
+
+#include "GoTools/compositemodel/ftSurface.h"
+#include "GoTools/compositemodel/ftEdge.h"
+#include "GoTools/compositemodel/Vertex.h"
+#include "GoTools/tesselator/GenericTriMesh.h"
+#include "GoTools/utils/Point.h"
+#include <vector>
+#include <map>
+
+
+namespace Go
+{
+
+  /** Watertight tesselation of a set of faces.
+   * Each edge is discretized once, and the discretization is shared
+   * by the two adjacent faces. Thus, the meshes of adjacent faces fit
+   * exactly along common boundaries. The face interiors are
+   * triangulated in the parameter domain with the boundary points as
+   * constraints and refined until the chordal deviation and the
+   * normal deviation are within the given tolerances. The result is
+   * one mesh with a common vertex array for all faces.
+   * Vertices along sharp edges, where the normals of the adjacent
+   * faces differ by more than the crease angle, are duplicated with
+   * one normal for each smooth side. The copies have exactly the same
+   * position, and positionIndex() relates them.
+   */
+
+  class SurfaceModelTesselator
+  {
+  public:
+    /// Constructor
+    /// \param chord_tol Maximum distance between the triangles and the
+    ///                  surfaces, measured at edge midpoints and centroids
+    /// \param ang_tol Maximum angle (in radians) between surface normals
+    ///                in the vertices of a triangle edge
+    SurfaceModelTesselator(double chord_tol, double ang_tol);
+
+    /// Destructor
+    ~SurfaceModelTesselator();
+
+    /// Limit the number of vertices in the triangulation of one face
+    /// \param max_nmb Maximum number of vertices, default is 100000
+    void setMaxFaceVertices(int max_nmb)
+    {
+      max_face_vertices_ = max_nmb;
+    }
+
+    /// Set the angle between face normals above which a common
+    /// vertex gets separate normals in the adjacent faces
+    /// \param crease_ang Angle in radians, default is 0.5
+    void setCreaseAngle(double crease_ang)
+    {
+      crease_ang_ = crease_ang;
+    }
+
+    /// Tesselate the given faces
+    /// \param faces Faces to tesselate. Adjacency information is taken
+    ///              from the twin pointers of the face edges
+    /// \return Mesh with shared vertices. The parameter values of a
+    ///         vertex refer to the first face containing it, and the
+    ///         boundary flag is set for vertices on face boundaries.
+    shared_ptr<GenericTriMesh> 
+      tesselate(const std::vector<shared_ptr<ftSurface> >& faces);
+
+    /// Indices (in the input vector) of the faces that could not be
+    /// tesselated in the last call to tesselate(). The mesh is not
+    /// closed along the boundaries of these faces.
+    const std::vector<int>& failedFaces() const
+    {
+      return failed_faces_;
+    }
+
+    /// For each vertex in the last mesh, the index of the first vertex
+    /// with the same position. Differs from the vertex index only for
+    /// copies made at sharp edges.
+    const std::vector<int>& positionIndex() const
+    {
+      return position_idx_;
+    }
+
+  private:
+    // Discretization of one edge in the parameter of the geometry curve
+    // of the edge which owns the discretization
+    struct EdgeDisc
+    {
+      ftEdge* owner;            // The edge of the curve parameters
+      std::vector<double> par;  // Curve parameters
+      std::vector<int> vx;      // Indices in the global vertex array
+    };
+
+    double chord_tol_;
+    double ang_tol_;
+    double crease_ang_;
+    int max_face_vertices_;
+
+    // Global vertices
+    std::vector<Point> vertices_;
+    std::vector<std::vector<std::pair<int, Point> > > normals_;  // Per face
+    std::vector<Point> params_;
+    std::vector<int> boundary_;
+    std::map<Vertex*, int> vertex_idx_;
+    std::map<ftEdge*, EdgeDisc> edge_disc_;
+
+    // Position of the edges in the input, (face, loop, edge) numbered
+    // consecutively. Decides which of two twins owns the discretization
+    // independent of memory layout.
+    std::map<ftEdge*, int> edge_idx_;
+
+    // Global triangles and the face of each triangle
+    std::vector<int> triangles_;
+    std::vector<int> tri_face_;
+
+    std::vector<int> failed_faces_;
+    std::vector<int> position_idx_;
+
+    int addVertex(const Point& pos);
+
+    int vertexIndex(shared_ptr<Vertex> vx);
+
+    const EdgeDisc& discretizeEdge(ftEdge* edge);
+
+    void refineEdge(ftEdge* edge, double t1, double t2, 
+		    const Point& pos1, const Point& pos2, int level,
+		    std::vector<double>& par);
+
+    bool tesselateFace(ftSurface* face, int face_idx);
+
+    void splitCreaseVertices();
+  };
+
+} // namespace Go
+
+#endif // _SURFACEMODELTESSELATOR_H
@@ -41,6 +41,7 @@
 #define _SMOOTHCURVESET_H
 
 #include "GoTools/creators/ConstraintDefinitions.h"
+#include "GoTools/creators/SparseGramMatrix.h"
 #include "GoTools/geometry/SplineCurve.h"
 
 namespace Go
@@ -260,7 +261,7 @@ private:
   int kpointer_; // Used to differ corresponding coefs + whether coef is known.
 
   // Storage of the equation system.
-  std::vector<double> gmat_;         // Matrix at left side of equation system.  
+  SparseGramMatrix gmat_;            // Matrix at left side of equation system.  
   std::vector<double> gright_;       // Right side of equation system. 
 
   // Set pointers between identical coefficients at a periodic seem
@@ -60,6 +60,7 @@
 
 #include "GoTools/geometry/SplineSurface.h"
 #include "GoTools/creators/ConstraintDefinitions.h"
+#include "GoTools/creators/SparseGramMatrix.h"
 #include <vector>
 
 namespace Go
@@ -192,7 +193,7 @@ protected:
     //    std::vector<double>::iterator  scoef;   // Pointer to surface coefficients.      
 
     // Storage of the equation system.
-    std::vector<double> gmat_;       // Matrix at left side of equation system.
+    SparseGramMatrix gmat_;          // Matrix at left side of equation system.
     std::vector<double> gright_;     // Right side of equation system.      
 
     /// Given the value of non-zero B-spline functions, compute the value
@@ -71,7 +71,6 @@ public:
 
 private:
 
-  double omega_;        // Relaxation parameter.
   int conv_type_; // We operate with 4 different types of convergence estimates.
   bool symm_;
 
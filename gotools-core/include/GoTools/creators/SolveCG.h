@@ -53,13 +53,20 @@
 //    Based on  : PrCG.h written by Mike Floater
 //   -----------------------------------------------------------------------
 
+#include "GoTools/utils/CsrMatrix.h"
+#include "GoTools/utils/SparsePreconditioner.h"
+#include "GoTools/utils/KrylovSolver.h"
 #include <vector>
 
 namespace Go
 {
 
+class SparseGramMatrix;
+
 /// Solve the equation system Ax=b where A is a symmetric
 /// positive definite matrix using the Conjugate Gradient Method.
+/// The matrix, the preconditioners and the iteration are implemented
+/// by CsrMatrix, SparsePreconditioner and KrylovSolver.
 class SolveCG
 {
 public:
@@ -79,10 +86,28 @@ public:
     /// \param nn the number of unknowns in the system.
     void attachMatrix(double *gmat, int nn);
 
-    /// Prepare for preconditioning.
+    /// Attach the left side of the equation system given as a sparse
+    /// matrix. The nonzero entries are copied. No test is applied on
+    /// whether the matrix really is symmetric and positive definite.
+    /// \param gmat the system matrix for the linear equations.
+    void attachMatrix(const SparseGramMatrix& gmat);
+
+    /// Prepare for preconditioning by a relaxed incomplete LU
+    /// factorization.
     /// \param relaxfac relaxation parameter. Range: [0,0, 1.0].
     virtual void precondRILU(double relaxfac);
 
+    /// Prepare for preconditioning by an incomplete Cholesky
+    /// factorization.
+    void precondIC0();
+
+    /// Prepare for diagonal (Jacobi) preconditioning.
+    void precondJacobi();
+
+    /// Prepare for preconditioning by algebraic multigrid with
+    /// aggregation. Suitable for large systems.
+    void precondAMG();
+
     /// Solve the equation system by conjugate gradient method.
     /// \param ex the solution vector.  The input should be the initial
     ///           guess.  Size is equal to nn.
@@ -91,6 +116,16 @@ public:
     /// \return 0: success, 1: iterationcount exceeded, < 0: error.
     int solve(double *ex, double *eb, int nn);
 
+    /// Solve the equation system for several right hand sides at once,
+    /// typically one for each coordinate.
+    /// \param ex the solution vectors stored one after another. The
+    ///           input should be the initial guess.  Size is nn*num_rhs.
+    /// \param eb the right sides stored one after another.
+    /// \param nn the number of unknowns int the system.
+    /// \param num_rhs the number of right hand sides.
+    /// \return 0: success, 1: iterationcount exceeded, < 0: error.
+    int solve(double *ex, double *eb, int nn, int num_rhs);
+
     /// Set numerical tolerance used by the solver.
     /// \param tolerance numerical tolerance.
     void setTolerance(double tolerance = 1.0e-6)
@@ -101,74 +136,44 @@ public:
     void setMaxIterations(int max_iterations)
     {max_iterations_ = max_iterations;}
 
+    /// Number of iterations used in the last solve.
+    int numIterations() const
+    {return iterations_;}
+
 
 protected:
 
-    std::vector<double> A_;   // Sparse matrix containing the left side
-                              // of the equation system.
+    CsrMatrix A_;      // Sparse matrix containing the left side
+                       // of the equation system.
     int nn_;           // Size of equation system, i.e. number of unknowns.
-    int np_;           // Number of non-zero entries in the equation system.
-    std::vector<int> irow_;  // The indexes in A_ and jcol_ of the
-                          // first non-zeros of the nn_ rows.
-    std::vector<int> jcol_;  // The np_ indexes j of the non-zero elements
 
     double  tolerance_; // The numerical tolerance deciding if we have reached a solution.
     int     max_iterations_; // The maximal number of iterations to be used by solver.
+    int     iterations_;     // Number of iterations used in the last solve.
 
-    // Parameters used in RILU preconditioning.
-
-    std::vector<double> M_;  // Preconditioning matrix.
     double omega_;        // Relaxation parameter, in the range [0.0, 1.0].
-
-    std::vector<int> diagonal_;  // Index of diagonal elements in the jcol
-    int diagset_; // Whether the index of the diagonal elements has been set.
+    shared_ptr<SparsePreconditioner> precond_;  // Preconditioner, if any.
 
     /// Compute the matrix product sy = A_ * sx.
     /// \param sx the vector to be multiplied by the matrix.
     /// \param sy the resulting vector.
-    template <typename RandomIterator1, typename RandomIterator2>
-    void matrixProduct(RandomIterator1 sx, RandomIterator2 sy)
-    {
-	int kj, ki;
-	for(kj=0; kj<nn_; kj++) {
-	    sy[kj] = 0.0;
-	    for(ki=irow_[kj]; ki<irow_[kj+1]; ki++) {
-		sy[kj] += A_[ki] * sx[jcol_[ki]];
-	    }
-	}
-    }
+    void matrixProduct(const double* sx, double* sy)
+    { A_.multiply(sx, sy); }
 
     /// Given an index in the full equation system, get the index in A_.
-    int getIndex(int ki, int kj);
+    int getIndex(int ki, int kj)
+    { return A_.getIndex(ki, kj); }
 
     /// Apply preconditioning matrix, i.e. solve the equation system
-    /// M_*s = r, where M_ stores an LU-factorized matrix.
+    /// M*s = r, where M is the preconditioner.
     /// \param r the input (right side) vector.
     /// \param s the output (unknown) vector.
-    void forwBack(double *r, double *s);
+    void forwBack(double *r, double *s)
+    { precond_->apply(r, s); }
 
     // Compute sy = A_^T * sx.
-    void transposedMatrixProduct(double *sx, double *sy);
-
-    /// Solve the equation system by conjugate gradient method
-    /// using a given RILU (Relaxed Incomplete LU) preconditioner
-    /// \param ex the solution vector.  The input should be the initial
-    ///           guess.  Size is equal to nn.
-    /// \param eb the right side of the equation. Size is equal to nn.
-    /// \param nn the number of unknowns int the system.
-    /// \return 0: success, 1: iterationcount exceeded, < 0: error.
-    int solveRILU(double *ex, double *eb, int nn);
-
-    // Solve the equation system by conjugate gradient method
-    /// \param ex the solution vector.  The input should be the initial
-    ///           guess.  Size is equal to nn.
-    /// \param eb the right side of the equation. Size is equal to nn.
-    /// \param nn the number of unknowns int the system.
-    /// \return 0: success, 1: iterationcount exceeded, < 0: error.
-    int solveStd(double *ex, double *eb, int nn);
-
-    /// Print to file ("fM.m") the preconditioning matrix.
-    void printPrecond();	// Print LU factorised preconditioning matrix
+    void transposedMatrixProduct(double *sx, double *sy)
+    { A_.transposedMultiply(sx, sy); }
 
 };
 
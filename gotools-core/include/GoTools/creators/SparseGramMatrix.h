@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SPARSEGRAMMATRIX_H_
+#define _SPARSEGRAMMATRIX_H_
+
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+/// Square sparse matrix used to assemble the left side of the equation
+/// systems in the smoothing and approximation creators (SmoothSurf,
+/// SmoothSurfSet, SmoothCurveSet and SmoothVolume). The energy and
+/// least squares terms only couple coefficients with overlapping
+/// support, and the matrix is stored row by row with sorted column
+/// indices. The expected nonzero pattern should be given up front by
+/// addTensorPattern(), entries outside the pattern are inserted when
+/// they are first accessed. Entries within the pattern may be updated
+/// concurrently with addAtomic(). Insertion is never allowed in a
+/// parallel region, since it reorganizes a row that other threads may
+/// be reading.
+class GO_API SparseGramMatrix
+{
+public:
+    /// Constructor. Empty matrix.
+    SparseGramMatrix();
+
+    /// Constructor. Matrix of size nn*nn without nonzero entries.
+    explicit SparseGramMatrix(int nn);
+
+    /// Destructor.
+    ~SparseGramMatrix();
+
+    /// Number of rows and columns.
+    int size() const
+    { return (int)cols_.size(); }
+
+    /// Number of stored entries.
+    size_t numEntries() const;
+
+    /// Change the size of the matrix. If the matrix is reduced, the
+    /// leading nn*nn block is kept.
+    void resize(int nn);
+
+    /// Remove all entries.
+    void clear();
+
+    /// Set all entries to zero, but keep the pattern.
+    void zero();
+
+    /// Add the pattern of a tensor product spline space. Two
+    /// coefficients are coupled if their B-splines have overlapping
+    /// support in all parameter directions.
+    /// \param pivot position in the equation system of each coefficient,
+    ///        negative if the coefficient is not free. The first
+    ///        parameter direction runs fastest.
+    /// \param num_coefs number of coefficients in each parameter direction
+    /// \param order order in each parameter direction
+    /// \param num_dir number of parameter directions (1, 2 or 3)
+    /// \param num_blocks number of diagonal blocks, e.g. one for each
+    ///        geometry dimension if the dimensions are solved together
+    /// \param block_size size of each diagonal block
+    void addTensorPattern(const std::vector<int>& pivot,
+			  const int num_coefs[], const int order[],
+			  int num_dir, int num_blocks = 1,
+			  int block_size = 0);
+
+    /// Reference to an entry. The entry is inserted if it does not exist.
+    double& operator()(int row, int col);
+
+    /// Value of an entry. Zero if the entry does not exist.
+    double operator()(int row, int col) const;
+
+    /// Pointer to an entry, or NULL if it does not exist.
+    double* find(int row, int col);
+
+    /// Add to an entry. Safe to call from several threads as long as
+    /// the entry is within the pattern. Outside a parallel region a
+    /// missing entry is inserted, inside one nothing is done.
+    /// \return false if the entry is missing and could not be inserted
+    bool addAtomic(int row, int col, double val);
+
+    /// Compressed row storage of the nonzero entries.
+    /// \param irow index of the first entry of each row in jcol and
+    ///        values, size nn+1
+    /// \param jcol column index of each nonzero entry
+    /// \param values nonzero entries
+    void getCompressedRows(std::vector<int>& irow, std::vector<int>& jcol,
+			   std::vector<double>& values) const;
+
+private:
+    std::vector<std::vector<int> > cols_;     // Sorted column indices in each row
+    std::vector<std::vector<double> > vals_;  // Entries in each row
+
+    double& insert(int row, int col);
+};
+
+} // namespace Go
+
+#endif // _SPARSEGRAMMATRIX_H_
@@ -50,6 +50,8 @@
 namespace Go
 {
 
+class BandedLU;
+
     /** An Interpolator that generates a spline curve
      *  interpolating the given dataset.
      */
@@ -110,6 +112,24 @@ public:
 		     const std::vector<double>& tangent_points,
 		     std::vector<double>& coefs);
 
+    /// Interpolate several data sets given at the same parameter values,
+    /// without tangent information.  The basis must have been specified in
+    /// advance (by \ref makeBasis() or \ref setBasis()), and the number of
+    /// basis functions must be equal to the number of points.  The banded
+    /// interpolation matrix is factorized once and reused for all data sets.
+    /// \param params vector containing the parameters for the data points.
+    /// \param num_sets the number of data sets.
+    /// \param dimension the spatial dimension of the data points.
+    /// \param points the data sets stored consecutively, each set consisting
+    ///               of params.size()*dimension values.
+    /// \param coefs Upon function completion, this vector will hold the
+    ///              control points of the interpolating curves, stored
+    ///              consecutively in the same order as the data sets.
+    void interpolateSets(const std::vector<double>& params,
+			 int num_sets, int dimension,
+			 const double* points,
+			 std::vector<double>& coefs);
+
     /// The interpolating function, as inherited by \ref Interpolator. 
     /// Does cubic spline interpolation of points (does not care
     /// about tangents).  It constructs its own basis based on the
@@ -224,6 +244,11 @@ public:
     }
 
 private:
+    /// Factorized interpolation matrix of the points and tangents in
+    /// the current basis
+    shared_ptr<BandedLU> collocationMatrix(const std::vector<double>& params,
+					   const std::vector<int>& tangent_index);
+
     CondType ctype_;
     shared_ptr<Point> start_tangent_;
     shared_ptr<Point> end_tangent_;
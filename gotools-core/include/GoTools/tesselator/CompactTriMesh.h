@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _COMPACTTRIMESH_H
+#define _COMPACTTRIMESH_H
+
+#include "GoTools/tesselator/GeneralMesh.h"
+#include <vector>
+#include <iostream>
+
+namespace Go
+{
+
+/** Compact triangle mesh with single precision vertices and normals
+ * and 32 bit triangle indices. Meshes are appended one at a time, and
+ * vertices closer than a given tolerance are merged so that a
+ * tesselation consisting of several face meshes becomes one indexed
+ * mesh with shared vertices. Vertices on opposite sides of a sharp
+ * edge are kept apart, so that each side keeps its own normal.
+ * Positions may optionally be quantized to a regular grid in the
+ * bounding box. The mesh is written directly as binary PLY or STL.
+ * STL output can also be streamed: write the header, then the facets
+ * of one mesh at a time, and clear the mesh in between.
+ */
+class GO_API CompactTriMesh
+{
+public:
+    /// Constructor. 
+    /// \param weld_tol Vertices closer than this tolerance are merged.
+    /// No merging is performed if the tolerance is not positive.
+    /// \param use_normals Whether or not normals should be stored
+    CompactTriMesh(double weld_tol = 0.0, bool use_normals = true);
+
+    /// Destructor
+    ~CompactTriMesh();
+
+    /// Set the angle between the normals of two coinciding vertices
+    /// above which they are not merged
+    /// \param crease_ang Angle in radians, default is 0.5
+    void setCreaseAngle(double crease_ang)
+    { crease_ang_ = crease_ang; }
+
+    /// Append a mesh. Triangle strips of a RegularMesh are expanded
+    /// to triangles. Normals are averaged in merged vertices.
+    void addMesh(GeneralMesh* mesh);
+
+    /// Number of vertices
+    int numVertices() const
+    { return (int)vert_.size()/3; }
+
+    /// Number of triangles
+    int numTriangles() const
+    { return (int)triangles_.size()/3; }
+
+    /// Check if normals are stored
+    bool useNormals() const
+    { return use_norm_; }
+
+    /// Vertices stored as x1 y1 z1 x2 y2 z2 ...
+    const float* vertexArray() const;
+
+    /// Normal information, same layout as the vertices
+    const float* normalArray() const;
+
+    /// Indices of the vertices of each triangle
+    const unsigned int* triangleIndexArray() const;
+
+    /// Quantize the positions to a grid with 2^nmb_bits - 1 intervals
+    /// in each direction of the bounding box of the mesh. The vertex
+    /// array is updated with the quantized positions.
+    /// \param nmb_bits Number of bits per coordinate, at most 16
+    /// \retval pos Quantized positions, 3 entries per vertex
+    /// \retval offset Minimum corner of the bounding box
+    /// \retval scale Grid spacing. Position = offset + scale*pos
+    void quantize(int nmb_bits, std::vector<unsigned short>& pos,
+		  double offset[], double scale[]);
+
+    /// Approximate memory consumption in bytes
+    size_t memorySize() const;
+
+    /// Write as binary little endian PLY
+    void writeBinaryPLY(std::ostream& os) const;
+
+    /// Write as binary STL
+    void writeBinarySTL(std::ostream& os) const;
+
+    /// Write the 84 byte header of a binary STL file
+    /// \param nmb_triangles Number of facets following the header
+    static void writeBinarySTLHeader(std::ostream& os,
+				     unsigned int nmb_triangles);
+
+    /// Write the triangles as binary STL facets without a header
+    void writeBinarySTLFacets(std::ostream& os) const;
+
+    /// Release the data used to merge vertices and free unused
+    /// capacity. Meshes added later are not merged with the current ones.
+    void finalize();
+
+    /// Remove all vertices and triangles
+    void clear();
+
+private:
+    double weld_tol_;
+    bool use_norm_;
+
+    double crease_ang_;
+
+    std::vector<float> vert_;
+    std::vector<float> norm_;
+    std::vector<unsigned int> triangles_;
+
+    // Spatial hash of the vertices that may be merged, with cell size
+    // weld_tol_. A bucket holds the first vertex of a chain, and
+    // next_vx_ links the chain. Vertices before first_weld_vx_ are not
+    // in the hash.
+    std::vector<unsigned int> bucket_;
+    std::vector<unsigned int> next_vx_;
+    unsigned int first_weld_vx_;
+
+    // Cell in a regular grid with cell size weld_tol_
+    struct Cell
+    {
+	long long i, j, k;
+    };
+
+    Cell cell(const double pos[]) const;
+
+    size_t bucketIndex(const Cell& curr) const;
+
+    void rehash(size_t nmb_buckets);
+
+    unsigned int vertexIndex(const double pos[], const double* nrm);
+};
+
+} // namespace Go
+
+
+#endif // _COMPACTTRIMESH_H
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BANDEDLU_H
+#define _BANDEDLU_H
+
+#include "GoTools/utils/config.h"
+#include "GoTools/utils/errormacros.h"
+#include <vector>
+
+namespace Go
+{
+
+/** LU decomposition with partial pivoting of a square band matrix.
+ * The matrix has kl sub diagonals and ku super diagonals. Pivoting
+ * extends the upper band of the factor to kl+ku super diagonals, so
+ * each row stores 2*kl+ku+1 entries. Factorization costs O(n*kl*(kl+ku))
+ * and each solve O(n*(2*kl+ku)) per right hand side, compared to
+ * O(n^3) and O(n^2) for the dense LU decomposition in LUDecomp.h.
+ * The factorization is computed once and may be used to solve for
+ * any number of right hand sides.
+ */
+class GO_API BandedLU
+{
+public:
+    /// Constructor. All entries are initialized to zero.
+    /// \param num_rows Number of rows (and columns)
+    /// \param kl Number of sub diagonals
+    /// \param ku Number of super diagonals
+    BandedLU(int num_rows, int kl, int ku);
+
+    /// Number of rows
+    int numRows() const
+    { return n_; }
+
+    /// Check if the entry (row, col) is within the band
+    bool inBand(int row, int col) const
+    { return (col >= row - kl_ && col <= row + ku_); }
+
+    /// Access matrix entry (row, col) before factorization. The entry
+    /// must lie within the band.
+    double& operator()(int row, int col)
+    {
+	ASSERT(row >= 0 && row < n_ && col >= 0 && col < n_);
+	ASSERT(inBand(row, col));
+	return band_[row*width_ + col - row + kl_];
+    }
+
+    /// Compute the LU decomposition. Throws if the matrix is singular.
+    void factorize();
+
+    /// Check if the matrix is factorized
+    bool factorized() const
+    { return factorized_; }
+
+    /// Solve AX = B. The right hand sides are stored row by row, i.e.
+    /// B(i,j) = rhs[i*num_rhs + j], which is the layout of the
+    /// coefficients of a spline object with dimension num_rhs.
+    /// On return, rhs contains the solution.
+    void solve(double* rhs, int num_rhs) const;
+
+private:
+    int n_;
+    int kl_;
+    int ku_;
+    int width_;
+    bool factorized_;
+    std::vector<double> band_;
+    std::vector<int> pivot_;
+};
+
+} // namespace Go
+
+#endif // _BANDEDLU_H
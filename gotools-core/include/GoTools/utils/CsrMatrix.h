@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _CSRMATRIX_H
+#define _CSRMATRIX_H
+
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+/** Square sparse matrix in compressed row storage (CSR). The column
+ * indices within each row are sorted in increasing order. This is the
+ * storage used by the iterative solvers in KrylovSolver.h and by the
+ * preconditioners in SparsePreconditioner.h. Matrix vector products
+ * are computed in parallel when OpenMP is enabled, and may be applied
+ * to several vectors at the same time, i.e. the matrix is traversed
+ * once for all right hand sides.
+ */
+class GO_API CsrMatrix
+{
+public:
+    /// Constructor. Empty matrix.
+    CsrMatrix();
+
+    /// Constructor. The arrays are swapped into the matrix, i.e. the
+    /// input arrays are empty on return.
+    /// \param nn Number of rows (and columns)
+    /// \param irow Index of the first entry of each row, size nn+1
+    /// \param jcol Column index of each entry, sorted within each row
+    /// \param values The entries
+    CsrMatrix(int nn, std::vector<int>& irow, std::vector<int>& jcol,
+	      std::vector<double>& values);
+
+    /// Constructor. Extract the nonzero entries of a dense matrix.
+    /// \param dense The matrix stored row by row, size nn*nn
+    /// \param nn Number of rows (and columns)
+    CsrMatrix(const double* dense, int nn);
+
+    /// Number of rows (and columns)
+    int size() const
+    { return nn_; }
+
+    /// Number of stored entries
+    int numEntries() const
+    { return (int)values_.size(); }
+
+    /// Index of the first entry of each row, size size()+1
+    const std::vector<int>& rowStart() const
+    { return irow_; }
+
+    /// Column index of each entry
+    const std::vector<int>& columnIndex() const
+    { return jcol_; }
+
+    /// The entries
+    const std::vector<double>& values() const
+    { return values_; }
+
+    /// The entries
+    std::vector<double>& values()
+    { return values_; }
+
+    /// Index of the entry (row, col) in values(), or -1 if the entry is
+    /// not stored.
+    int getIndex(int row, int col) const;
+
+    /// Value of the entry (row, col), zero if the entry is not stored.
+    double operator()(int row, int col) const
+    {
+	int idx = getIndex(row, col);
+	return (idx < 0) ? 0.0 : values_[idx];
+    }
+
+    /// The diagonal of the matrix, zero where no entry is stored.
+    void diagonal(std::vector<double>& diag) const;
+
+    /// Compute y = A*x for num_rhs vectors stored one after another,
+    /// each of length size().
+    void multiply(const double* x, double* y, int num_rhs = 1) const;
+
+    /// Compute y = A^T*x for num_rhs vectors stored one after another.
+    void transposedMultiply(const double* x, double* y, int num_rhs = 1) const;
+
+    /// Compute the residual r = b - A*x for num_rhs vectors.
+    void residual(const double* x, const double* b, double* r,
+		  int num_rhs = 1) const;
+
+private:
+    int nn_;
+    std::vector<int> irow_;
+    std::vector<int> jcol_;
+    std::vector<double> values_;
+};
+
+} // namespace Go
+
+#endif // _CSRMATRIX_H
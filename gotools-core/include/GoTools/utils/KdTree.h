@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _KDTREE_H
+#define _KDTREE_H
+
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <utility>
+
+namespace Go
+{
+
+/** Adaptive kd-tree for neighbour searches in a set of points of any
+ * dimension. The point set is split recursively at the median of the
+ * coordinate with the largest extent until a node holds no more than
+ * the bucket size number of points. The depth of the tree therefore
+ * follows the point density, which makes the tree suitable for
+ * scattered data with large variations in density, like scanned
+ * point clouds. Each node stores the bounding box of its points, which
+ * is used for pruning during the searches.
+ *
+ * The points are copied into the tree. Results refer to the index of
+ * the points in the input array. Single queries may be called from
+ * several threads at the same time. The batch queries, searching for
+ * the neighbours of many points, run in parallel when OpenMP is
+ * enabled.
+ */
+class GO_API KdTree
+{
+public:
+    /// Constructor. Empty tree.
+    KdTree();
+
+    /// Constructor. Build the tree.
+    /// \param points the points, stored consecutively
+    /// \param num_points number of points
+    /// \param dim dimension of the points
+    /// \param bucket_size maximum number of points in a leaf node
+    KdTree(const double* points, int num_points, int dim, int bucket_size = 8);
+
+    /// Build the tree, replacing any previous content.
+    void build(const double* points, int num_points, int dim,
+	       int bucket_size = 8);
+
+    /// Number of points in the tree
+    int numPoints() const
+    { return (int)perm_.size(); }
+
+    /// Dimension of the points
+    int dimension() const
+    { return dim_; }
+
+    /// Run the batch queries in parallel if OpenMP is available.
+    /// Default is true.
+    void setMultiCore(bool multi_core)
+    { multi_core_ = multi_core; }
+
+    /// The point closest to pnt.
+    /// \param pnt the query point
+    /// \param dist2 the squared distance to the closest point
+    /// \param exclude_coincident if true, points coinciding with pnt
+    ///        are not considered
+    /// \return index of the closest point, -1 if there is none
+    int nearest(const double* pnt, double& dist2,
+		bool exclude_coincident = false) const;
+
+    /// The k points closest to pnt, sorted by increasing distance.
+    /// Fewer points are returned if the tree contains less than k
+    /// points that may be considered.
+    /// \param pnt the query point
+    /// \param k number of points sought
+    /// \param idx the indices of the points
+    /// \param dist2 the squared distances to the points
+    /// \param exclude_coincident if true, points coinciding with pnt
+    ///        are not considered
+    void kNearest(const double* pnt, int k, std::vector<int>& idx,
+		  std::vector<double>& dist2,
+		  bool exclude_coincident = false) const;
+
+    /// All points within the distance radius from pnt, in no
+    /// particular order.
+    /// \param pnt the query point
+    /// \param radius the radius of the ball
+    /// \param idx the indices of the points
+    /// \param exclude_coincident if true, points coinciding with pnt
+    ///        are not returned
+    void radiusSearch(const double* pnt, double radius, std::vector<int>& idx,
+		      bool exclude_coincident = false) const;
+
+    /// The k nearest points for each of num_pnts query points. The
+    /// result for query point ki is stored at positions ki*k, ...,
+    /// ki*k+k-1 in idx and dist2. Unused positions have index -1.
+    void kNearestAll(const double* pnts, int num_pnts, int k,
+		     std::vector<int>& idx, std::vector<double>& dist2,
+		     bool exclude_coincident = false) const;
+
+    /// All points within the distance radius from each of num_pnts
+    /// query points. The result for query point ki is stored at
+    /// positions start[ki], ..., start[ki+1]-1 in idx.
+    void radiusSearchAll(const double* pnts, int num_pnts, double radius,
+			 std::vector<int>& start, std::vector<int>& idx,
+			 bool exclude_coincident = false) const;
+
+private:
+    struct Node
+    {
+	int start;      // Range of the points of the node, in tree order
+	int end;
+	int child;      // Index of the first child, -1 for leaf nodes.
+			// The second child follows the first.
+    };
+
+    int dim_;
+    int bucket_size_;
+    bool multi_core_;
+    std::vector<double> pnts_;   // Points in tree order
+    std::vector<int> perm_;      // Input index of the points in tree order
+    std::vector<Node> nodes_;
+    std::vector<double> box_;    // Bounding box of each node, the
+				 // minimum followed by the maximum
+
+    void buildNode(int node, const double* points);
+    double boxDist2(int node, const double* pnt) const;
+    void searchKNearest(int node, const double* pnt, int k,
+			bool exclude_coincident,
+			std::vector<std::pair<double, int> >& heap) const;
+    void searchRadius(int node, const double* pnt, double radius2,
+		      bool exclude_coincident, std::vector<int>& idx) const;
+};
+
+} // namespace Go
+
+#endif // _KDTREE_H
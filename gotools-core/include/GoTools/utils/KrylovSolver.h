@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _KRYLOVSOLVER_H
+#define _KRYLOVSOLVER_H
+
+#include "GoTools/utils/CsrMatrix.h"
+#include "GoTools/utils/SparsePreconditioner.h"
+#include <vector>
+
+namespace Go
+{
+
+/** Preconditioned Krylov subspace solvers for sparse equation systems
+ * in compressed row storage. Several right hand sides with the same
+ * matrix may be solved at once, typically one for each coordinate of
+ * the geometry. In the conjugate gradient method the matrix and the
+ * preconditioner are then applied to all right hand sides that have
+ * not yet converged in each iteration. Vector operations and matrix
+ * vector products run in parallel when OpenMP is enabled.
+ *
+ * The iteration for one right hand side stops when rho < nn*tol^2 and
+ * rho/rho0 < tol, where rho is the inner product of the residual and
+ * the preconditioned residual (the squared residual norm for BiCGStab),
+ * rho0 is the initial value, nn is the number of unknowns and tol is
+ * the tolerance. The relative criterion may be switched off, leaving
+ * the absolute criterion used by PrBiCGStab and PrCG for tol*sqrt(nn).
+ *
+ * Statistics on the last solve, i.e. the number of iterations and the
+ * relative residual for each right hand side, are kept in the solver.
+ *
+ * Not all iterative solvers in GoTools use this class yet. PrCG and
+ * PrBiCGStab in the parametrization module work on the abstract
+ * PrMatrix interface and are still used by PrPrewavelet_F and by
+ * PrParametrizeInt::parametrize3d and new_parametrize3d. Only the
+ * planar system of PrParametrizeInt::parametrize has been moved here.
+ */
+class GO_API KrylovSolver
+{
+public:
+    /// Constructor. Tolerance 1.0e-6 and at most 1000 iterations.
+    KrylovSolver();
+
+    /// Set numerical tolerance
+    void setTolerance(double tolerance)
+    { tolerance_ = tolerance; }
+
+    /// Whether the iteration also requires rho/rho0 < tol to stop.
+    /// Default is true
+    void setRelativeStop(bool relative_stop)
+    { relative_stop_ = relative_stop; }
+
+    /// Set the maximal number of iterations for each right hand side
+    void setMaxIterations(int max_iterations)
+    { max_iterations_ = max_iterations; }
+
+    /// Solve Ax=b for a symmetric positive definite matrix by the
+    /// conjugate gradient method.
+    /// \param A the system matrix
+    /// \param precond preconditioner, NULL if the system is not
+    ///        preconditioned. Must be symmetric.
+    /// \param x the solution vectors, stored one after another. The input
+    ///        is used as initial guess.
+    /// \param b the right hand sides, stored one after another
+    /// \param num_rhs number of right hand sides
+    /// \return 0: success, 1: iteration count exceeded
+    int solveCG(const CsrMatrix& A, const SparsePreconditioner* precond,
+		double* x, const double* b, int num_rhs = 1);
+
+    /// Solve Ax=b for a general matrix by the biconjugate gradient
+    /// stabilized method with right preconditioning. The right hand
+    /// sides are solved one by one.
+    /// \return 0: success, 1: iteration count exceeded, -1: breakdown
+    int solveBiCGStab(const CsrMatrix& A, const SparsePreconditioner* precond,
+		      double* x, const double* b, int num_rhs = 1);
+
+    /// Number of iterations used in the last solve, largest over all
+    /// right hand sides
+    int numIterations() const;
+
+    /// Number of iterations used for one right hand side in the last solve
+    int numIterations(int rhs) const
+    { return iterations_[rhs]; }
+
+    /// Relative residual norm |b - Ax|/|b| for one right hand side
+    /// after the last solve
+    double relativeResidual(int rhs) const
+    { return residual_[rhs]; }
+
+private:
+    double tolerance_;
+    bool relative_stop_;
+    int max_iterations_;
+    std::vector<int> iterations_;
+    std::vector<double> residual_;
+
+    void computeStatistics(const CsrMatrix& A, const double* x,
+			   const double* b, int num_rhs);
+};
+
+} // namespace Go
+
+#endif // _KRYLOVSOLVER_H
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SPARSEPRECONDITIONER_H
+#define _SPARSEPRECONDITIONER_H
+
+#include "GoTools/utils/CsrMatrix.h"
+#include <vector>
+
+namespace Go
+{
+
+/// Base class for preconditioners used by the iterative solvers in
+/// KrylovSolver.h. A preconditioner approximates the inverse of the
+/// system matrix.
+class GO_API SparsePreconditioner
+{
+public:
+    /// Destructor
+    virtual ~SparsePreconditioner();
+
+    /// Compute s = M^{-1}*r for num_rhs vectors stored one after another.
+    virtual void apply(const double* r, double* s, int num_rhs = 1) const = 0;
+
+    /// Number of unknowns
+    virtual int size() const = 0;
+};
+
+
+/// Diagonal (Jacobi) preconditioner. Cheap to set up and apply, and
+/// applied in parallel when OpenMP is enabled.
+class GO_API JacobiPreconditioner : public SparsePreconditioner
+{
+public:
+    /// Constructor. Zero diagonal entries are replaced by one.
+    JacobiPreconditioner(const CsrMatrix& A);
+
+    virtual ~JacobiPreconditioner();
+
+    virtual void apply(const double* r, double* s, int num_rhs = 1) const;
+
+    virtual int size() const
+    { return (int)inv_diag_.size(); }
+
+private:
+    std::vector<double> inv_diag_;
+};
+
+
+/// Relaxed incomplete LU factorization without fill in (RILU(0)). The
+/// factors have the same sparsity pattern as the matrix. Fill in entries
+/// that are discarded are added to the diagonal scaled by the relaxation
+/// parameter, i.e. relaxation 0 gives ILU(0) and relaxation 1 gives the
+/// modified ILU(0). The factorization assumes a structurally symmetric
+/// matrix.
+class GO_API ILU0Preconditioner : public SparsePreconditioner
+{
+public:
+    /// Constructor. Compute the factorization.
+    /// \param A the system matrix
+    /// \param relaxfac relaxation parameter, in the range [0.0, 1.0]
+    /// \param drop_tol entries not larger than drop_tol in absolute value
+    ///        are ignored during elimination
+    /// \param num_factorized if non-negative, only the leading block of
+    ///        this size is factorized. The trailing rows are preconditioned
+    ///        by a diagonal matrix with the entry trailing_diag. Used for
+    ///        constrained optimization problems where the trailing block
+    ///        corresponds to the Lagrange multipliers.
+    /// \param trailing_diag diagonal entry of the trailing block
+    ILU0Preconditioner(const CsrMatrix& A, double relaxfac,
+		       double drop_tol = 0.0, int num_factorized = -1,
+		       double trailing_diag = 1.0);
+
+    virtual ~ILU0Preconditioner();
+
+    virtual void apply(const double* r, double* s, int num_rhs = 1) const;
+
+    virtual int size() const
+    { return nn_; }
+
+private:
+    int nn_;
+    std::vector<int> irow_;     // Pattern of the matrix, with all
+    std::vector<int> jcol_;     // diagonal entries present
+    std::vector<double> lu_;    // Factors, L has unit diagonal
+    std::vector<int> diag_;     // Index of the diagonal entries
+
+    int getIndex(int row, int col) const;
+};
+
+
+/// Incomplete Cholesky factorization without fill in (IC(0)) of a
+/// symmetric positive definite matrix, M = L*L^T where L has the
+/// pattern of the lower triangle of the matrix. If the factorization
+/// breaks down, the corresponding diagonal entry of the matrix is used.
+class GO_API IC0Preconditioner : public SparsePreconditioner
+{
+public:
+    /// Constructor. Compute the factorization. Only the lower triangle
+    /// of the matrix is accessed.
+    IC0Preconditioner(const CsrMatrix& A);
+
+    virtual ~IC0Preconditioner();
+
+    virtual void apply(const double* r, double* s, int num_rhs = 1) const;
+
+    virtual int size() const
+    { return nn_; }
+
+private:
+    int nn_;
+    std::vector<int> irow_;    // Lower triangle of L by rows, the
+    std::vector<int> jcol_;    // diagonal is the last entry of each row
+    std::vector<double> lval_;
+};
+
+
+/// Algebraic multigrid preconditioner with plain aggregation. Unknowns
+/// that are strongly coupled are aggregated into one coarse unknown,
+/// and the coarse matrices are the Galerkin products P^T*A*P where P is
+/// piecewise constant. One V-cycle with damped Jacobi smoothing is
+/// applied, and the coarsest system is solved directly. The V-cycle is
+/// symmetric, so the preconditioner may be used with conjugate
+/// gradients. Intended for symmetric positive definite matrices.
+class GO_API AggregationAMGPreconditioner : public SparsePreconditioner
+{
+public:
+    /// Constructor. Build the multigrid hierarchy.
+    /// \param A the system matrix
+    /// \param strength threshold for strong coupling between unknowns i
+    ///        and j: |a_ij| >= strength*sqrt(|a_ii*a_jj|)
+    /// \param num_smooth number of pre and post smoothing steps
+    /// \param coarse_size maximum size of the coarsest system
+    AggregationAMGPreconditioner(const CsrMatrix& A, double strength = 0.08,
+				 int num_smooth = 2, int coarse_size = 200);
+
+    virtual ~AggregationAMGPreconditioner();
+
+    virtual void apply(const double* r, double* s, int num_rhs = 1) const;
+
+    virtual int size() const
+    { return nn_; }
+
+    /// Number of levels in the hierarchy, including the coarsest level
+    int numLevels() const
+    { return (int)levels_.size() + 1; }
+
+private:
+    struct Level
+    {
+	CsrMatrix A;                  // Matrix at this level
+	std::vector<double> inv_diag; // Inverse diagonal, for smoothing
+	std::vector<int> aggregate;   // Coarse unknown of each unknown
+	int num_coarse;               // Number of coarse unknowns
+    };
+
+    int nn_;
+    std::vector<Level> levels_;
+    std::vector<std::vector<double> > coarse_lu_;   // LU factorized
+    std::vector<int> coarse_perm_;                  // coarsest matrix
+    int num_smooth_;
+    double damping_;
+
+    void vcycle(int level, const double* r, double* s) const;
+    void coarseSolve(const double* r, double* s) const;
+};
+
+} // namespace Go
+
+#endif // _SPARSEPRECONDITIONER_H
@@ -60,6 +60,7 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <cstdio>
 
 #if 0
 #include "Vertex.h"
@@ -209,6 +210,23 @@ public:
 
 };
 
+/// Wall clock time in seconds spent in the phases of
+/// IGESconverter::readIGES()
+struct IGEStimings
+{
+public:
+    IGEStimings()
+	: read(0.0), directory(0.0), independent(0.0), dependent(0.0),
+	  trimmed(0.0)
+    {}
+
+    double read;         // Reading the file and splitting it into sections
+    double directory;    // Parsing the header and the directory entries
+    double independent;  // Entities not referring to other entities
+    double dependent;    // Composite curves, boundaries, curves on surfaces
+    double trimmed;      // Bounded and trimmed surfaces (143 and 144)
+};
+
 /// The converter between the IGES fileformat, the file format
 /// used in GoTools, a file format used for SISL. The disp file format
 /// is outdated.
@@ -240,6 +258,30 @@ public:
     void writedisp(std::ostream& os);
     /// Write the content of this converter to an IGES-file
     void writeIGES(std::ostream& os);
+    /// Write a single geometry object to a g2-file, without storing
+    /// it in the converter. The colour is an RGB-triplet in percent,
+    /// or empty.
+    void writegoEntity(std::ostream& os, shared_ptr<Go::GeomObject> obj,
+		       const std::vector<double>& colour
+		       = std::vector<double>());
+
+    /// Start writing an IGES-file to os. The entities are given one
+    /// by one with addEntityIGES() and are not stored in the
+    /// converter. The directory and parameter sections are kept in
+    /// temporary files until closeIGES() is called, so the memory use
+    /// does not depend on the size of the model. The stream must
+    /// stay valid until closeIGES() returns.
+    void openIGES(std::ostream& os);
+    /// Add a spline surface, spline curve or bounded surface to the
+    /// IGES-file opened by openIGES(). The colour is an RGB-triplet
+    /// in percent, or empty. Entities are formatted in batches, in
+    /// parallel if OpenMP is enabled.
+    void addEntityIGES(shared_ptr<Go::GeomObject> obj,
+		       const std::vector<double>& colour
+		       = std::vector<double>());
+    /// Write the remaining entities and the sections of the
+    /// IGES-file opened by openIGES() to the stream.
+    void closeIGES();
 
     /// Add one more geometry object to this converter
     void addGeom(shared_ptr<Go::GeomObject> sp);
@@ -266,6 +308,8 @@ public:
     int num_group() { return (int)group_.size(); }
     /// Gives dangerous but necessary direct access to header info
     IGESheader& header() { return header_; }
+    /// Time spent in the phases of the last call to readIGES()
+    const IGEStimings& readTimings() const { return timings_; }
 
 private:
     // Data members
@@ -278,6 +322,7 @@ private:
     std::vector<ftGroupGeom> group_;
     IGESheader header_;
     std::vector<IGESdirentry> direntries_;
+    IGEStimings timings_;
     EntityList supp_ent_; // The supported iges entities.
 
     // Local storage of pointers to entities
@@ -320,12 +365,63 @@ private:
 
     ccp start_of_P_section_;
 
+    // An entity waiting to be written by the streaming IGES writer.
+    // An empty object denotes the colour entity stream_colours_[colour].
+    struct StreamEntity
+    {
+	shared_ptr<Go::GeomObject> obj;
+	int colour;   // Index in stream_colours_, or -1 if no colour
+    };
+
+    // State of the streaming IGES writer, see openIGES()
+    std::ostream* stream_os_;
+    std::FILE* stream_dsect_;     // Temporary file for the D section
+    std::FILE* stream_psect_;     // Temporary file for the P section
+    int stream_num_dir_;          // Number of directory entries written
+    int stream_num_p_;            // Number of P lines written
+    std::vector<std::vector<double> > stream_colours_;
+    std::vector<int> stream_colour_dir_;  // D line of each colour entity
+    std::vector<StreamEntity> stream_queue_;
+
+    // Data for a bounded or trimmed surface (entity 143 or 144),
+    // collected before the surface is constructed.
+    struct TrimmedSurfData
+    {
+	shared_ptr<Go::ParamSurface> surf;
+	std::vector<std::vector<shared_ptr<Go::CurveOnSurface> > > loops;
+	double tol;
+    };
+
     // Utility members
 
-    bool readSingleIGESLine(std::istream& is, char line_terminated[81],
-			    int& line_number, IGESSection& sect);
+    /// Reads the whole stream into memory and splits it into the
+    /// sections of the file. The P-section is stored without the
+    /// back pointers in columns 64..71.
+    void readIGESsections(std::istream& is, std::string sbufs[5]);
+    /// Reads the entity of directory entry i if it does not refer to
+    /// other entities, and returns an empty pointer otherwise. Does
+    /// not modify the converter, and may be called concurrently.
+    shared_ptr<Go::GeomObject>
+      readIGESindependent(const char* posP0, int i, Go::Point& normal);
+    /// Constructs the bounded surfaces from the collected data.
+    /// Surfaces sharing no objects with other surfaces are made in
+    /// parallel.
+    void makeBoundedSurfaces(std::vector<TrimmedSurfData>& data,
+			     int entity_type,
+			     std::vector<shared_ptr<Go::BoundedSurface> >& bd_sfs);
     void writeSingleIGESLine(std::ostream& os, const char line_terminated[73],
 			     int line_number, IGESSection sect);
+    /// Writes the S and G sections and sets their line counts.
+    void writeIGESstartAndGlobal(std::ostream& os, int num_lines[5]);
+    /// Writes the parameter data of one entity of the streaming
+    /// writer to g, and the directory entries to dirent. Does not
+    /// modify the converter, and may be called concurrently.
+    void formatIGESentity(const StreamEntity& entity, int colour,
+			  std::string& g, std::vector<IGESdirentry>& dirent,
+			  int& Pcurr);
+    /// Formats the queued entities of the streaming writer and
+    /// appends them to the temporary D and P sections.
+    void flushIGESstream();
     /// If whereami is within the P section, it gives the current line
     /// number.
     int whichPLine(ccp whereami);
@@ -376,10 +472,12 @@ private:
                           std::vector<IGESdirentry>& dirent, int& Pcurr,
 			  int dependency = 0);
     shared_ptr<Go::SplineCurve>
-      readIGEScurve(const char* start, int num_lines, int direntry_index);
+      readIGEScurve(const char* start, int num_lines, int direntry_index,
+		    Go::Point& normal);
 //     shared_ptr<Go::SplineCurve>
     shared_ptr<Go::BoundedCurve>
-      readIGESline(const char* start, int num_lines, int direntry_index);
+      readIGESline(const char* start, int num_lines, int direntry_index,
+		   Go::Point& normal);
     shared_ptr<Go::PointCloud3D> readIGESpointCloud(const char* start,
 						int num_lines);
     shared_ptr<Go::PointCloud3D>
@@ -409,8 +507,8 @@ private:
     shared_ptr<Go::SplineCurve>
       readIGESlinearPath(const char* start, int num_lines, int form);
 
-    shared_ptr<Go::BoundedSurface>
-        readIGESboundedSurf(const char* start, int num_lines);
+    void readIGESboundedSurf(const char* start, int num_lines,
+			     TrimmedSurfData& data);
     void writeIGESboundedSurf(Go::BoundedSurface *surf, int colour,
 			      std::string& g, 
                               std::vector<IGESdirentry>& dirent, int& Pcurr);
@@ -431,8 +529,8 @@ private:
 			     std::vector<shared_ptr<Go::CurveOnSurface> >& crv_vec);
     // void writeIGEScurveOnSurf(Go::CurveOnSurface *curve, std::string& g,
     //                          std::vector<IGESdirentry>& dirent, int& Pcurr);
-    shared_ptr<Go::BoundedSurface> readIGEStrimmedSurf(const char* start,
-						     int num_lines);
+    void readIGEStrimmedSurf(const char* start, int num_lines,
+			     TrimmedSurfData& data);
 //     shared_ptr<SplineSurface> readIGEStrimmedSurf(const char* start,
 // 						     int num_lines);
 
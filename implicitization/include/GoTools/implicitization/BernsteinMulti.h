@@ -143,6 +143,15 @@ public:
     /// \return the value of the polynomial at pt
     double operator() (const std::vector<double>& pt) const
     { return (*this)(pt[0], pt[1]); }
+    /// Evaluation in many parameter points. The de Casteljau
+    /// algorithm is run for blocks of points at the same time, and the
+    /// blocks are evaluated in parallel if OpenMP is enabled.
+    /// \param u the first parameter of each point
+    /// \param v the second parameter of each point
+    /// \retval res the values of the polynomial, res[i] = p(u[i],v[i])
+    void evaluate(const std::vector<double>& u,
+		  const std::vector<double>& v,
+		  std::vector<double>& res) const;
 
     /// Check if the polynomial is the zero function
     /// \param eps the threshold value with which every coefficient
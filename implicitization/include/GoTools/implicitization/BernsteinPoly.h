@@ -106,6 +106,14 @@ public:
     /// \return the value of the polynomial at t
     double operator() (double t) const;
 
+    /// Evaluation in many parameter values. The de Casteljau algorithm
+    /// is run for blocks of parameter values at the same time, and the
+    /// blocks are evaluated in parallel if OpenMP is enabled.
+    /// \param t the parameter values
+    /// \retval res the values of the polynomial, res[i] = p(t[i])
+    void evaluate(const std::vector<double>& t,
+		  std::vector<double>& res) const;
+
     /// Check if the polynomial is the zero function
     /// \param eps the threshold value with which every coefficient
     /// is compared
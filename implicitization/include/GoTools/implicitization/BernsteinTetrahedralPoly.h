@@ -140,6 +140,14 @@ public:
         return tmp[0];
     }
 
+    /// Evaluation in many points. The de Casteljau algorithm is run
+    /// for blocks of points at the same time, and the blocks are
+    /// evaluated in parallel if OpenMP is enabled.
+    /// \param u parameter points given in barycentric coordinates
+    /// \retval res the values of the polynomial, res[i] = p(u[i])
+    void evaluate(const std::vector<Array<double, 4> >& u,
+		  std::vector<double>& res) const;
+
     /// Calculates the norm of the polynomial, defined as the sum of
     /// absolute values of the coefficients divided by the number of
     /// coefficients. This norm is not the same as the L1 norm of the
@@ -136,6 +136,18 @@ public:
 	    * pascals_triangle[n-i-j][k];
     }
 
+    /// Computes the lines 0 to n of Pascal's triangle without using
+    /// the table of the class. Contrary to the other functions, this
+    /// function may be called from several threads at the same time.
+    /// \param n the level up to which you want to make the triangle
+    /// \retval tab the binomial coefficients, stored line by line such
+    /// that \f$tab[k(k+1)/2 + i] = {k \choose i}\f$.
+    static void pascalsTriangle(int n, std::vector<double>& tab);
+
+    /// As above, but storing the triangle in an array with room for
+    /// (n+1)*(n+2)/2 values.
+    static void pascalsTriangle(int n, double* tab);
+
 private:
     void init(int n);
     void expand(int n);
@@ -58,6 +58,32 @@ class SplineSurface;
 class BoundingBox;
 
 
+/// Diagnostics from the computation of the nullspace of the matrix D.
+/// The singular values are those of D. A small ratio sigma_min /
+/// sigma_next means that the null-vector is well determined, while a
+/// ratio close to 1 indicates that the degree is too low or that the
+/// nullspace has more than one dimension.
+struct ImplicitDiagnostics
+{
+    ImplicitDiagnostics()
+	: rows(0), cols(0), null_dim(0), sigma_max(-1.0),
+	  sigma_min(-1.0), sigma_next(-1.0),
+	  time_matrix(0.0), time_reduce(0.0), time_svd(0.0)
+    {}
+
+    int rows;             ///< Number of rows in D
+    int cols;             ///< Number of columns in D
+    int null_dim;         ///< Numerical dimension of the nullspace
+    double sigma_max;     ///< Largest singular value
+    double sigma_min;     ///< Singular value of the returned null-vector
+    double sigma_next;    ///< Smallest singular value above sigma_min
+    double time_matrix;   ///< Seconds spent making the matrix D, and
+                          ///< reducing the matrices of the patches
+    double time_reduce;   ///< Seconds spent in the QR reduction
+    double time_svd;      ///< Seconds spent in the SVD of the factor R
+};
+
+
 /// Creates a barycentric coordinate system from a given spline curve
 void create_bary_coord_system2D(const SplineCurve& curve,
 				BaryCoordSystem2D& bc);
@@ -117,6 +143,22 @@ void make_matrix(const PointCloud4D& cloud, int deg,
 void make_implicit_svd(std::vector<std::vector<double> >& mat, 
 		       std::vector<double>& b, double& sigma_min);
 
+/// Replaces mat by the upper triangular factor R of a QR
+/// factorization of mat computed by Householder reflections. R has
+/// at most mat[0].size() rows and the same singular values and right
+/// singular vectors as mat. Tall matrices are split in blocks of rows
+/// that are factorized in parallel, after which the stacked factors
+/// are reduced in the same way.
+void make_triangular(std::vector<std::vector<double> >& mat);
+
+/// Performs implicitization using a QR factorization followed by an
+/// SVD of the square triangular factor. Gives the same null-vector as
+/// make_implicit_svd(), but is much faster when mat has many more
+/// rows than columns, which is the case for high degrees and for
+/// surfaces with many patches. On output mat holds the factor R.
+void make_implicit_qr(std::vector<std::vector<double> >& mat,
+		      std::vector<double>& b, ImplicitDiagnostics& diag);
+
 /// Performs implicitization using Gaussian elimination. This method
 /// is suitable when the implicitization is exact. If the
 /// implicitization is approximate, make_implicit_svd() is better.
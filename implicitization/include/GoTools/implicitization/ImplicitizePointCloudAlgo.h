@@ -42,6 +42,7 @@
 
 
 #include "GoTools/implicitization/BernsteinTetrahedralPoly.h"
+#include "GoTools/implicitization/ImplicitUtils.h"
 #include "GoTools/geometry/PointCloud.h"
 #include "GoTools/utils/BaryCoordSystem.h"
 
@@ -114,6 +115,12 @@ public:
 	sigma_min = sigma_min_;
     }
 
+    /// Get timings and conditioning information from the last call to
+    /// perform().
+    /// \return the diagnostics of the nullspace computation
+    const ImplicitDiagnostics& getDiagnostics() const
+    { return diag_; }
+
 private:
     PointCloud3D cloud_;
     BernsteinTetrahedralPoly implicit_;
@@ -121,6 +128,7 @@ private:
     int deg_;
     double tol_;
     double sigma_min_;
+    ImplicitDiagnostics diag_;
 
 };
 
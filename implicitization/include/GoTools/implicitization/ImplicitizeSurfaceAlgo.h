@@ -42,6 +42,7 @@
 
 
 #include "GoTools/implicitization/BernsteinTetrahedralPoly.h"
+#include "GoTools/implicitization/ImplicitUtils.h"
 #include "GoTools/geometry/SplineSurface.h"
 #include "GoTools/utils/BaryCoordSystem.h"
 
@@ -116,6 +117,12 @@ public:
 	sigma_min = sigma_min_;
     }
 
+    /// Get timings and conditioning information from the last call to
+    /// perform().
+    /// \return the diagnostics of the nullspace computation
+    const ImplicitDiagnostics& getDiagnostics() const
+    { return diag_; }
+
 private:
     SplineSurface surf_;
     BernsteinTetrahedralPoly implicit_;
@@ -123,6 +130,7 @@ private:
     int deg_;
     double tol_;
     double sigma_min_;
+    ImplicitDiagnostics diag_;
 
 };
 
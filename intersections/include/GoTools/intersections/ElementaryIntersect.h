@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _ELEMENTARYINTERSECT_H
+#define _ELEMENTARYINTERSECT_H
+
+
+#include "GoTools/geometry/ParamSurface.h"
+#include "GoTools/geometry/ParamCurve.h"
+#include "GoTools/utils/Point.h"
+#include <vector>
+
+
+namespace Go {
+
+
+class ElementarySurface;
+class AlgObj3DInt;
+
+
+/// Intersection of elementary surfaces (Plane, Disc, Cylinder, Cone,
+/// Sphere and Torus) by closed form expressions or by reduction to
+/// an implicit function problem.
+namespace ElementaryIntersect {
+
+
+/// Compute the intersection between two elementary surfaces in closed
+/// form. The computation is performed on the infinite surfaces, the
+/// result must be restricted to the surface domains afterwards, see
+/// restrictToSurface().  Coincident surfaces and configurations for
+/// which no closed form expression is implemented are not handled.
+/// \param sf1 the first surface
+/// \param sf2 the second surface
+/// \param tol geometric tolerance
+/// \retval int_pts isolated intersection points (tangential contact)
+/// \retval int_crvs intersection curves (Line, Circle or Ellipse)
+/// \return \a true if the configuration was handled, \a false otherwise
+bool intersectClosedForm(const ElementarySurface* sf1,
+			 const ElementarySurface* sf2, double tol,
+			 std::vector<Point>& int_pts,
+			 std::vector<shared_ptr<ParamCurve> >& int_crvs);
+
+/// The implicit equation of an elementary surface in power basis.
+/// The equation is scaled to have a unit gradient at a point on the
+/// surface, thus function values approximate distances close to the
+/// surface. For a cone both nappes are included.
+/// \param sf the elementary surface
+/// \return the algebraic object, empty if the surface type is not
+/// supported
+shared_ptr<AlgObj3DInt> implicitForm(const ElementarySurface* sf);
+
+/// Degree of the implicit equation of an elementary surface, or -1
+/// if no implicit equation is available.
+int implicitDegree(const ElementarySurface* sf);
+
+/// Restrict intersection curves computed on a surface without
+/// boundaries (or on the underlying surface of a trimmed surface) to
+/// the part lying on the given surface. Curves with an unbounded
+/// parameter interval are first bounded by the box of the surface.
+/// A closed curve passing its seam inside the surface is returned as
+/// one piece where the curve type allows the pieces to be joined.
+/// \param sf the surface, may be a bounded or trimmed surface
+/// \param tol geometric tolerance
+/// \param int_pts intersection points, points outside the surface
+/// are removed
+/// \param int_crvs intersection curves, replaced by the pieces lying
+/// on the surface
+void restrictToSurface(const ParamSurface* sf, double tol,
+		       std::vector<Point>& int_pts,
+		       std::vector<shared_ptr<ParamCurve> >& int_crvs);
+
+
+} // namespace ElementaryIntersect
+
+} // namespace Go
+
+
+#endif // _ELEMENTARYINTERSECT_H
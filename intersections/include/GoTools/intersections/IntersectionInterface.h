@@ -41,6 +41,8 @@
 #define _INTERSECTIONINTERFACE_H
 
 #include "GoTools/geometry/ParamCurve.h"
+#include "GoTools/geometry/ParamSurface.h"
+#include "GoTools/utils/Point.h"
 #include <vector>
 
 // This collection of functions provides an interface to the GoTools intersection
@@ -52,6 +54,33 @@ namespace Go
     void intersectCurves(shared_ptr<ParamCurve> crv1, shared_ptr<ParamCurve> crv2,
 			 double tol, std::vector<std::pair<double, double> >& intersection_points);
 
+    /// Intersection between two parametric surfaces in 3D.
+    /// If both surfaces are elementary surfaces (or trimmed elementary
+    /// surfaces), the intersection is computed in closed form when such
+    /// an expression is available. If one of the surfaces is elementary,
+    /// its implicit equation is inserted into the spline representation
+    /// of the other surface and the intersection is found as the zero
+    /// set of the resulting spline function. Otherwise, or if
+    /// use_algebraic is false, the general spline surface intersector
+    /// is applied.
+    /// Where a spline representation is needed, an elementary surface
+    /// without boundaries (for instance a Plane) is bounded by the
+    /// parameter domain of its trimming loops or, if it is not trimmed,
+    /// by the part of it lying within the bounding box of the other
+    /// surface. An exception is thrown if no such bound can be found,
+    /// i.e. if both surfaces are unbounded and no closed form exists.
+    /// \param sf1 the first surface
+    /// \param sf2 the second surface
+    /// \param tol geometric tolerance
+    /// \retval int_pts isolated intersection points in geometry space
+    /// \retval int_crvs intersection curves in geometry space
+    /// \param use_algebraic apply the elementary surface shortcuts
+    void intersectSurfaces(shared_ptr<ParamSurface> sf1,
+			   shared_ptr<ParamSurface> sf2, double tol,
+			   std::vector<Point>& int_pts,
+			   std::vector<shared_ptr<ParamCurve> >& int_crvs,
+			   bool use_algebraic = true);
+
 } // namespace Go
 
 #endif // _INTERSECTIONINTERFACE_H
@@ -45,6 +45,7 @@
 #include "GoTools/utils/Point.h"
 #include "GoTools/geometry/BsplineBasis.h"
 #include "GoTools/topology/tpTopologyTable.h"
+#include "GoTools/isogeometric_model/ElementQuadrature.h"
 
 
 
@@ -128,6 +129,17 @@ namespace Go
     // pre evaluated values are removed, and this function must be called again
     virtual void performPreEvaluation(std::vector<std::vector<double> >& Gauss_par) = 0;
 
+    // Pre evaluate as above, and give the quadrature weights corresponding
+    // to the Gauss parameters in each parameter direction. The weights are
+    // used by the element-wise quadrature data
+    virtual void performPreEvaluation(std::vector<std::vector<double> >& Gauss_par,
+				      std::vector<std::vector<double> >& Gauss_wgt) = 0;
+
+    // Fetch the pre evaluated basis functions and geometry stored element by
+    // element, to be streamed through by an assembler.
+    // Requires pre evaluation to be performed, otherwise NULL is returned
+    virtual const ElementQuadrature* getElementQuadrature() const = 0;
+
     // Return the value of the Jacobian determinant of the parameterization in a specified Gauss point.
     // Requires pre evaluation to be performed
     virtual double getJacobian(std::vector<int>& index_of_Gauss_point) const = 0;
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef __DOFNUMBERING_H
+#define __DOFNUMBERING_H
+
+
+#include <vector>
+#include <iostream>
+
+
+namespace Go
+{
+
+  // Mapping from the local coefficient enumeration of each block in a
+  // multi-block model to a global enumeration of the degrees of freedom.
+  // Coefficients that are identified, for instance along a face shared
+  // between two blocks, get the same global number. Global numbers are
+  // consecutive, starting at 0, and given in the order of first occurrence
+  // when running through the blocks.
+
+  class DofNumbering
+  {
+  public:
+    // Constructor. The numbering is empty until it is built or read
+    DofNumbering();
+
+    // Destructor
+    ~DofNumbering();
+
+    // Build the numbering
+    // nmb_local: Number of coefficients in each block
+    // same:      Pairs of coefficients that should have the same global number.
+    //            A coefficient is given by its position in the flat sequence of
+    //            all blocks, i.e. the position in the block plus the total
+    //            number of coefficients in the preceding blocks
+    void build(const std::vector<int>& nmb_local,
+	       const std::vector<std::pair<int,int> >& same);
+
+    // Number of blocks
+    int nmbBlocks() const
+    { return (int)block_start_.size() - 1; }
+
+    // Number of local coefficients in a block
+    int nmbLocal(int block) const
+    { return block_start_[block+1] - block_start_[block]; }
+
+    // Number of global degrees of freedom
+    int nmbGlobal() const
+    { return nmb_global_; }
+
+    // Global number of a local coefficient in a block
+    int globalIndex(int block, int local) const
+    { return local_to_global_[block_start_[block] + local]; }
+
+    // Global numbers of all local coefficients in a block
+    const int* localToGlobal(int block) const
+    { return &local_to_global_[block_start_[block]]; }
+
+    // Write the numbering to stream
+    void write(std::ostream& os) const;
+
+    // Read a numbering written by write()
+    void read(std::istream& is);
+
+  private:
+    int nmb_global_;
+    std::vector<int> block_start_;      // Size nmbBlocks()+1
+    std::vector<int> local_to_global_;  // Global number for all local coefficients,
+                                        // block by block
+
+  };  // end class DofNumbering
+
+} // end namespace Go
+
+
+#endif    // #ifndef __DOFNUMBERING_H
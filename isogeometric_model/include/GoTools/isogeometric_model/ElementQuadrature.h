@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef __ELEMENTQUADRATURE_H
+#define __ELEMENTQUADRATURE_H
+
+
+#include <vector>
+
+
+namespace Go
+{
+
+  class BsplineBasis;
+  class SplineSurface;
+  class SplineVolume;
+
+  // Pre evaluated quadrature data for a tensor product spline space, stored
+  // element by element. An element is a non-empty knot span box of the
+  // solution space. For every element the global indices of the non-zero
+  // basis functions are stored once, and for every quadrature point in the
+  // element the values and parameter derivatives of these basis functions,
+  // the parameter value, the position and the Jacobian matrix of the
+  // geometry, and the quadrature weight are stored in contiguous arrays.
+  // The arrays for all elements follow each other, so an assembler can
+  // stream through them without any further lookup or evaluation.
+
+  class ElementQuadrature
+  {
+  public:
+
+    // Read only view of the quadrature data of one element
+    class Element
+    {
+    public:
+      Element(const ElementQuadrature* owner, int idx)
+	: owner_(owner), idx_(idx)
+      {}
+
+      // Index of this element
+      int index() const
+      { return idx_; }
+
+      // Number of quadrature points in this element
+      int nmbPoints() const
+      { return owner_->pt_start_[idx_+1] - owner_->pt_start_[idx_]; }
+
+      // Number of basis functions that are non-zero in this element
+      int nmbBasis() const
+      { return owner_->nmb_basis_; }
+
+      // Index of the knot span in a given parameter direction
+      int knotSpan(int pardir) const
+      { return owner_->knot_span_[idx_*owner_->pardim_ + pardir]; }
+
+      // Global indices (in the solution space) of the non-zero basis functions,
+      // nmbBasis() entries with the first parameter direction running fastest
+      const int* basisIndex() const
+      { return &owner_->basis_index_[idx_*owner_->nmb_basis_]; }
+
+      // Values of the non-zero basis functions in quadrature point pt
+      const double* basisValues(int pt) const
+      { return &owner_->values_[global(pt)*owner_->nmb_basis_]; }
+
+      // Parameter derivatives of the non-zero basis functions in quadrature
+      // point pt. pardir = 0 is the first parameter direction
+      const double* basisDerivs(int pt, int pardir) const
+      { return &owner_->derivs_[(global(pt)*owner_->pardim_ + pardir)*
+				owner_->nmb_basis_]; }
+
+      // Parameter value of quadrature point pt, pardim entries
+      const double* parameter(int pt) const
+      { return &owner_->param_[global(pt)*owner_->pardim_]; }
+
+      // Position of the geometry in quadrature point pt, dim entries
+      const double* position(int pt) const
+      { return &owner_->position_[global(pt)*owner_->dim_]; }
+
+      // Derivatives of the geometry in quadrature point pt, stored as
+      // pardim vectors of size dim, i.e. the transposed Jacobian matrix
+      const double* jacobian(int pt) const
+      { return &owner_->jacobian_[global(pt)*owner_->pardim_*owner_->dim_]; }
+
+      // Jacobian determinant of the geometry in quadrature point pt. For a
+      // surface in 3D this is the length of the normal vector
+      double jacobianDeterminant(int pt) const
+      { return owner_->det_[global(pt)]; }
+
+      // Quadrature weight in point pt in the parameter domain
+      double weight(int pt) const
+      { return owner_->weight_[global(pt)]; }
+
+    private:
+      const ElementQuadrature* owner_;
+      int idx_;
+
+      int global(int pt) const
+      { return owner_->pt_start_[idx_] + pt; }
+    };
+
+    // Iterator running through all elements
+    class const_iterator
+    {
+    public:
+      const_iterator(const ElementQuadrature* owner, int idx)
+	: owner_(owner), elem_(owner, idx)
+      {}
+
+      const Element& operator*() const
+      { return elem_; }
+
+      const Element* operator->() const
+      { return &elem_; }
+
+      const_iterator& operator++()
+      {
+	elem_ = Element(owner_, elem_.index() + 1);
+	return *this;
+      }
+
+      bool operator==(const const_iterator& other) const
+      { return elem_.index() == other.elem_.index(); }
+
+      bool operator!=(const const_iterator& other) const
+      { return elem_.index() != other.elem_.index(); }
+
+    private:
+      const ElementQuadrature* owner_;
+      Element elem_;
+    };
+
+    // Constructor. The cache is empty until one of the build functions
+    // is called
+    ElementQuadrature();
+
+    // Destructor
+    ~ElementQuadrature();
+
+    // Evaluate the basis functions of the solution surface and the geometry
+    // surface in all quadrature points and store the result by element.
+    // Gauss_par holds the quadrature parameters in each parameter direction,
+    // sorted, and Gauss_wgt the corresponding weights (already scaled with
+    // the length of the knot span). If Gauss_wgt is empty, all weights are
+    // set to one.
+    // NB! Quadrature points should not lie on knots
+    void build(const SplineSurface& solution, const SplineSurface& geometry,
+	       const std::vector<std::vector<double> >& Gauss_par,
+	       const std::vector<std::vector<double> >& Gauss_wgt);
+
+    // Volume version of the function above
+    void build(const SplineVolume& solution, const SplineVolume& geometry,
+	       const std::vector<std::vector<double> >& Gauss_par,
+	       const std::vector<std::vector<double> >& Gauss_wgt);
+
+    // Release all data
+    void clear();
+
+    // Number of elements containing quadrature points
+    int nmbElements() const
+    { return (int)pt_start_.size() - 1; }
+
+    // Total number of quadrature points
+    int nmbPoints() const
+    { return pt_start_.back(); }
+
+    // Number of basis functions that are non-zero in an element
+    int nmbBasis() const
+    { return nmb_basis_; }
+
+    // Number of parameter directions
+    int parDim() const
+    { return pardim_; }
+
+    // Dimension of the geometry
+    int dimension() const
+    { return dim_; }
+
+    // Access to one element
+    Element element(int idx) const
+    { return Element(this, idx); }
+
+    const_iterator begin() const
+    { return const_iterator(this, 0); }
+
+    const_iterator end() const
+    { return const_iterator(this, nmbElements()); }
+
+    // Compute Gauss-Legendre parameters and weights for all non-empty
+    // knot spans of a B-spline basis, with the number of points per span
+    // given by the order of the basis. The weights include the length of
+    // the knot span.
+    static void gaussParameters(const BsplineBasis& basis,
+				std::vector<double>& par,
+				std::vector<double>& wgt);
+
+  private:
+    int pardim_;
+    int dim_;
+    int nmb_basis_;
+
+    std::vector<int> pt_start_;      // First quadrature point of each element, size
+                                     // nmbElements()+1
+    std::vector<int> knot_span_;     // Knot span index per element and parameter direction
+    std::vector<int> basis_index_;   // Non-zero basis functions per element
+    std::vector<double> values_;     // Basis values per point
+    std::vector<double> derivs_;     // Basis derivatives per point and parameter direction
+    std::vector<double> param_;      // Parameter value per point
+    std::vector<double> position_;   // Geometry position per point
+    std::vector<double> jacobian_;   // Geometry derivatives per point
+    std::vector<double> det_;        // Jacobian determinant per point
+    std::vector<double> weight_;     // Quadrature weight per point
+
+    // Split sorted quadrature parameters into runs belonging to the same
+    // knot span and evaluate the basis in the given parameter direction
+    static void spanRuns(const BsplineBasis& basis,
+			 const std::vector<double>& par,
+			 std::vector<double>& basisvals,
+			 std::vector<int>& left,
+			 std::vector<int>& runs);
+
+    // Set up element structure from the runs in each parameter direction
+    void setElements(const std::vector<std::vector<int> >& runs,
+		     const std::vector<std::vector<int> >& left,
+		     int nmb_basis, int dim);
+
+  };  // end class ElementQuadrature
+
+} // end namespace Go
+
+
+#endif    // #ifndef __ELEMENTQUADRATURE_H
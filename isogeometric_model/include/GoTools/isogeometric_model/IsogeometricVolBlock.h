@@ -168,6 +168,12 @@ namespace Go
     // Release scratch related to pre evaluated basis functions and surface.
     virtual void erasePreEvaluatedBasisFunctions();
 
+    // Pre evaluate the basis functions of a specified solution space in
+    // Gauss points in all knot spans, with the number of points per span
+    // equal to the order of the solution space in each parameter direction.
+    // The result is fetched through the solution space
+    void performPreEvaluation(int solutionspace_idx);
+
     // Fetch boundary conditions
     // Get the number of boundary conditions attached to this block
     virtual int getNmbOfBoundaryConditions() const;
@@ -49,6 +49,7 @@
 #include "GoTools/isogeometric_model/IsogeometricModel.h"
 #include "GoTools/isogeometric_model/BdConditionType.h"
 #include "GoTools/isogeometric_model/IsogeometricVolBlock.h"
+#include "GoTools/isogeometric_model/DofNumbering.h"
 
 
 
@@ -126,6 +127,20 @@ namespace Go
     // Update spline spaces of the solution to ensure consistence
     virtual void updateSolutionSplineSpace(int solutionspace_idx);
 
+    // Pre evaluate the basis functions of a specified solution space in all
+    // blocks, see IsogeometricVolBlock::performPreEvaluation. Each block
+    // then provides element-wise quadrature data to an assembler through
+    // VolSolution::getElementQuadrature
+    void performPreEvaluation(int solutionspace_idx);
+
+    // Build a global numbering of the coefficients of a specified solution
+    // space in all blocks. Coefficients along a face shared by two blocks
+    // with matching spline spaces get the same number, and so do boundary
+    // coefficients of a block that coincide in the geometry because the
+    // block is degenerate or periodic. The blocks are processed in parallel.
+    // The numbering may be written to file and read back by a solver
+    void buildDofNumbering(int solutionspace_idx, DofNumbering& numbering);
+
     // Fetch all the single block defining this multi-block model
     void getIsogeometricBlocks(std::vector<shared_ptr<IsogeometricVolBlock> >& volblock);
 
@@ -71,6 +71,9 @@ namespace Go
     std::vector<double> points_;   // Position of the surface in the Gauss points
     std::vector<double> deriv_u_;  // 1. derivative of the surface in 1. par. dir. in the Gauss points
     std::vector<double> deriv_v_;  // 1. derivative of the surface in 2. par. dir. in the Gauss points
+
+    // The basis functions and the geometry in the Gauss points stored element by element
+    ElementQuadrature elements_;
   };
 
   // This class represents one solution in one block in a block-structured
@@ -190,6 +193,15 @@ namespace Go
     // pre evaluated values are removed, and this function must be called again
     virtual void performPreEvaluation(std::vector<std::vector<double> >& Gauss_par);
 
+    // Pre evaluate as above, with quadrature weights corresponding to the
+    // Gauss parameters in each parameter direction
+    virtual void performPreEvaluation(std::vector<std::vector<double> >& Gauss_par,
+				      std::vector<std::vector<double> >& Gauss_wgt);
+
+    // Fetch the pre evaluated data stored element by element
+    // Requires pre evaluation to be performed, otherwise NULL is returned
+    virtual const ElementQuadrature* getElementQuadrature() const;
+
     // Get value and 1. derivative of all non-zero rational basis funtions
     // in the given Gauss point
     // Requires pre evaluation to be performed
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef ELEMENT3D_H
+#define ELEMENT3D_H
+
+#include <vector>
+#include <algorithm>
+#include "GoTools/lrsplines3D/Direction3D.h"
+
+namespace Go {
+
+  class LRBSpline3D;
+
+// =============================================================================
+/// A box in the parameter domain of an LRSplineVolume not traversed by any
+/// mesh plane.  The element keeps track of the B-spline functions having
+/// support in it.
+class Element3D
+// =============================================================================
+{
+ public:
+  /// Constructor
+  Element3D() 
+  {
+    start_[0] = start_[1] = start_[2] = 0.0;
+    stop_[0] = stop_[1] = stop_[2] = 0.0;
+  }
+
+  /// Constructor given the element box
+  Element3D(double umin, double vmin, double wmin,
+	    double umax, double vmax, double wmax)
+  {
+    start_[0] = umin;
+    start_[1] = vmin;
+    start_[2] = wmin;
+    stop_[0] = umax;
+    stop_[1] = vmax;
+    stop_[2] = wmax;
+  }
+
+  /// Start parameter of the element in the given direction
+  double start(Direction3D d) const
+  {
+    return start_[d];
+  }
+
+  /// End parameter of the element in the given direction
+  double stop(Direction3D d) const
+  {
+    return stop_[d];
+  }
+
+  double umin() const { return start_[0]; }
+  double vmin() const { return start_[1]; }
+  double wmin() const { return start_[2]; }
+  double umax() const { return stop_[0]; }
+  double vmax() const { return stop_[1]; }
+  double wmax() const { return stop_[2]; }
+
+  /// Volume of the element in the parameter domain
+  double volume() const
+  {
+    return (stop_[0] - start_[0])*(stop_[1] - start_[1])*(stop_[2] - start_[2]);
+  }
+
+  /// Check if a parameter triple is inside the element
+  bool contains(double u, double v, double w) const
+  {
+    return (u >= start_[0] && u <= stop_[0] && v >= start_[1] && 
+	    v <= stop_[1] && w >= start_[2] && w <= stop_[2]);
+  }
+
+  /// Number of B-splines with support in this element
+  int nmbBasisFunctions() const
+  {
+    return (int)support_.size();
+  }
+
+  /// Add a B-spline to the support of this element
+  void addSupportFunction(LRBSpline3D* f)
+  {
+    if (!hasSupportFunction(f))
+      support_.push_back(f);
+  }
+
+  /// Remove a B-spline from the support of this element
+  void removeSupportFunction(LRBSpline3D* f)
+  {
+    std::vector<LRBSpline3D*>::iterator it = 
+      std::find(support_.begin(), support_.end(), f);
+    if (it != support_.end())
+      {
+	*it = support_.back();
+	support_.pop_back();
+      }
+  }
+
+  bool hasSupportFunction(LRBSpline3D* f) const
+  {
+    return (std::find(support_.begin(), support_.end(), f) != support_.end());
+  }
+
+  std::vector<LRBSpline3D*>::const_iterator supportBegin() const
+  {
+    return support_.begin();
+  }
+
+  std::vector<LRBSpline3D*>::const_iterator supportEnd() const
+  {
+    return support_.end();
+  }
+
+  const std::vector<LRBSpline3D*>& getSupport() const
+  {
+    return support_;
+  }
+
+ private:
+  double start_[3];
+  double stop_[3];
+  std::vector<LRBSpline3D*> support_;
+};
+
+} // end namespace Go
+
+#endif // ELEMENT3D_H
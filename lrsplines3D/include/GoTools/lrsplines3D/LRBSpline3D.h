@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef LRBSPLINE3D_H
+#define LRBSPLINE3D_H
+
+#include <vector>
+#include <iostream>
+#include "GoTools/utils/Point.h"
+#include "GoTools/geometry/Streamable.h"
+#include "GoTools/lrsplines3D/Direction3D.h"
+#include "GoTools/lrsplines3D/Mesh3D.h"
+
+namespace Go
+{
+
+// =============================================================================
+/// A single trivariate B-spline function of an LRSplineVolume together with
+/// its coefficient.  The local knot vectors are stored as indices into the
+/// distinct knot values of the volume's Mesh3D.  As in the bivariate case, the
+/// coefficient is stored multiplied by the scaling factor 'gamma' which
+/// ensures partition of unity of the LR B-spline basis.
+class LRBSpline3D : public Streamable
+// =============================================================================
+{
+ public:
+  /// Empty constructor, typically followed by read()
+  LRBSpline3D() : gamma_(1.0), mesh_(0) {};
+
+  /// Constructor.  The local knot vectors are given as indices in the mesh.
+  LRBSpline3D(const Point& c_g, double gamma,
+	      const std::vector<int>& kvec_u,
+	      const std::vector<int>& kvec_v,
+	      const std::vector<int>& kvec_w,
+	      const Mesh3D* mesh)
+    : coef_times_gamma_(c_g), gamma_(gamma), mesh_(mesh)
+  {
+    kvec_[0] = kvec_u;
+    kvec_[1] = kvec_v;
+    kvec_[2] = kvec_w;
+  }
+
+  /// Swap the contents of two B-splines
+  void swap(LRBSpline3D& rhs)
+  {
+    coef_times_gamma_.swap(rhs.coef_times_gamma_);
+    std::swap(gamma_, rhs.gamma_);
+    for (int d = 0; d < 3; ++d)
+      kvec_[d].swap(rhs.kvec_[d]);
+    std::swap(mesh_, rhs.mesh_);
+  }
+
+  /// Write the B-spline to a stream
+  virtual void write(std::ostream& os) const;
+
+  /// Read the B-spline from a stream.  The mesh pointer must be set afterwards.
+  virtual void read(std::istream& is);
+
+  /// Evaluate the B-spline function or one of its derivatives.  The returned
+  /// value is not multiplied by the spline coefficient, nor gamma.
+  /// The 'at_end' flags indicate that the parameter is at the end of the
+  /// domain in the corresponding direction, in which case the evaluation is
+  /// performed from the left.
+  double evalBasisFunction(double u, double v, double w,
+			   int u_deriv = 0, int v_deriv = 0, int w_deriv = 0,
+			   bool u_at_end = false, bool v_at_end = false,
+			   bool w_at_end = false) const;
+
+  /// Evaluate the B-spline and its derivatives up to order 'deriv', multiply
+  /// by the coefficient and gamma and add the result to 'der'.  The
+  /// derivatives are ordered as in ParamVolume::point(), 'der' must have room
+  /// for (deriv+1)*(deriv+2)*(deriv+3)/6 entries.
+  void evalder_add(double u, double v, double w, int deriv, Point der[],
+		   bool u_at_end, bool v_at_end, bool w_at_end) const;
+
+  /// Access the coefficient multiplied by the gamma factor
+        Point& coefTimesGamma()       { return coef_times_gamma_;}
+  const Point& coefTimesGamma() const { return coef_times_gamma_;}
+
+  /// The coefficient (not multiplied by gamma)
+  Point Coef() const { return coef_times_gamma_/gamma_;}
+
+  /// Access the gamma multiplier of this B-spline
+        double& gamma()       {return gamma_;}
+  const double& gamma() const {return gamma_;}
+
+  /// Dimension of the geometry space
+  int dimension() const {return coef_times_gamma_.dimension();}
+
+  /// Polynomial degree in the given direction
+  int degree(Direction3D d) const {return (int)kvec_[d].size() - 2;}
+
+  /// Local knot vector expressed as indices in the mesh
+  const std::vector<int>& kvec(Direction3D d) const {return kvec_[d];}
+        std::vector<int>& kvec(Direction3D d)       {return kvec_[d];}
+
+  /// Mesh index of the start and end of the support in direction 'd'
+  int suppMin(Direction3D d) const {return kvec_[d].front();}
+  int suppMax(Direction3D d) const {return kvec_[d].back();}
+
+  /// Parameter value of the start and end of the support in direction 'd'
+  double paramMin(Direction3D d) const {return mesh_->kval(d, kvec_[d].front());}
+  double paramMax(Direction3D d) const {return mesh_->kval(d, kvec_[d].back());}
+
+  /// Knot value number 'ix' in the local knot vector in direction 'd'
+  double knotval(Direction3D d, int ix) const {return mesh_->kval(d, kvec_[d][ix]);}
+
+  /// Number of occurences of the mesh index 'ix' in the local knot vector
+  /// in direction 'd'
+  int knotMult(Direction3D d, int ix) const
+  {
+    return (int)std::count(kvec_[d].begin(), kvec_[d].end(), ix);
+  }
+
+  /// Check if the support overlaps the box with the given mesh indices.
+  /// Overlaps along a boundary are not counted.
+  bool overlaps(const int low[], const int high[]) const
+  {
+    for (int d = 0; d < 3; ++d)
+      if (kvec_[d].front() >= high[d] || kvec_[d].back() <= low[d])
+	return false;
+    return true;
+  }
+
+  const Mesh3D* getMesh() const {return mesh_;}
+  void setMesh(const Mesh3D* mesh) {mesh_ = mesh;}
+
+ private:
+  Point coef_times_gamma_;
+  double gamma_; // normalizing weight to ensure partition of unity
+  std::vector<int> kvec_[3];  // Mesh indices of the local knot vectors
+  const Mesh3D* mesh_;
+};
+
+} // end namespace Go
+
+#endif // LRBSPLINE3D_H
@@ -0,0 +1,332 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _LRSPLINEVOLUME_H
+#define _LRSPLINEVOLUME_H
+
+#include <map>
+#include <vector>
+#include <memory>
+
+#include "GoTools/trivariate/ParamVolume.h"
+#include "GoTools/trivariate/SplineVolume.h"
+#include "GoTools/lrsplines3D/Mesh3D.h"
+#include "GoTools/lrsplines3D/LRBSpline3D.h"
+#include "GoTools/lrsplines3D/Element3D.h"
+
+namespace Go
+{
+
+// =============================================================================
+/// A locally refinable trivariate spline volume, the trivariate counterpart
+/// of LRSplineSurface.  The volume is defined on a box partition (Mesh3D) of
+/// its parameter domain.  The basis consists of trivariate B-splines whose
+/// local knot vectors include all mesh planes traversing their support.
+/// Refinement inserts a rectangular piece of a mesh plane and splits the
+/// affected B-splines only, so the number of coefficients grows with the
+/// refined region rather than with the full tensor product grid.
+class LRSplineVolume : public ParamVolume
+// =============================================================================
+{
+ public:
+  //
+  // SEARCH STRUCTURES
+  //
+  // Structure representing a refinement to carry out, i.e. a rectangular
+  // piece of a mesh plane.  The plane has the fixed value 'kval' in
+  // direction 'd'.  The rectangle is given by [start1, end1] in the first
+  // and [start2, end2] in the second of the remaining directions, taken in
+  // increasing order (v and w for an XDIR plane, u and w for YDIR and u and
+  // v for ZDIR).  The start and end values must be existing knot values.
+  struct Refinement3D {
+    double kval;      // value of the fixed parameter of the plane to insert
+    double start1;    // start value in the first non-fixed direction
+    double end1;      // end value in the first non-fixed direction
+    double start2;    // start value in the second non-fixed direction
+    double end2;      // end value in the second non-fixed direction
+    Direction3D d;    // direction of the fixed parameter
+    int multiplicity; // multiplicity of the plane
+
+    void setVal(double val, double st1, double e1, double st2, double e2,
+		Direction3D dir, int mult)
+    {
+      kval = val;
+      start1 = st1;
+      end1 = e1;
+      start2 = st2;
+      end2 = e2;
+      d = dir;
+      multiplicity = mult;
+    }
+  };
+
+  // 'BSKey' defines the key for storing/looking-up individual B-spline
+  // functions, the local knot values in the three parameter directions in
+  // sequence.  Unlike LRSplineSurface, the complete local knot vectors are
+  // used.  During refinement, B-splines which are not yet completely split
+  // may share support and end multiplicities with different functions, and
+  // the full key keeps these apart.  The comment in LRSplineSurface on the
+  // use of 'double' values as keys applies here as well: the values are
+  // always copied from the mesh, never computed.
+  struct BSKey 
+  {
+    std::vector<double> knots;
+    bool operator<(const BSKey& rhs) const
+    {
+      return knots < rhs.knots;
+    }
+  };
+
+  typedef std::map<BSKey, std::unique_ptr<LRBSpline3D> > BSplineMap;
+
+  // The ElementMap keeps track of the elements.  An element is identified
+  // by its lower-left-front corner.
+  struct ElemKey
+  {
+    double u_min, v_min, w_min;
+    bool operator<(const ElemKey& rhs) const
+    {
+      if (u_min != rhs.u_min)
+	return (u_min < rhs.u_min);
+      if (v_min != rhs.v_min)
+	return (v_min < rhs.v_min);
+      return (w_min < rhs.w_min);
+    }
+  };
+
+  typedef std::map<ElemKey, std::unique_ptr<Element3D> > ElementMap;
+
+  // Functions for generating the keys used when storing B-splines and
+  // elements.  (This is an implementation detail that should not worry users).
+  static BSKey generate_key(const LRBSpline3D& b);
+  static ElemKey generate_key(double umin, double vmin, double wmin);
+
+  // ----------------------------------------------------
+  // ---- CONSTRUCTORS, COPY, SWAP AND ASSIGNMENT -------
+  // ----------------------------------------------------
+  // Construct a tensor-product LR-spline volume.  The knot vectors contain
+  // coefs+deg+1 values each.  The coefficients are stored sequentially,
+  // with the shortest stride in the u-direction followed by v.
+  template<typename KnotIterator, typename CoefIterator>
+  LRSplineVolume(int deg_u, int deg_v, int deg_w,
+		 int coefs_u, int coefs_v, int coefs_w,
+		 int dimension,
+		 KnotIterator knotvals_u_start,
+		 KnotIterator knotvals_v_start,
+		 KnotIterator knotvals_w_start,
+		 CoefIterator coefs_start,
+		 double knot_tol = 1.0e-8)
+    : knot_tol_(knot_tol)
+  {
+    SplineVolume vol(coefs_u, coefs_v, coefs_w, deg_u+1, deg_v+1, deg_w+1,
+		     knotvals_u_start, knotvals_v_start, knotvals_w_start,
+		     coefs_start, dimension);
+    initFromSplineVolume(vol);
+  }
+
+  // Construct an LRSplineVolume based on a non-rational spline volume
+  LRSplineVolume(const SplineVolume* const vol, double knot_tol = 1.0e-8);
+
+  // Construct empty, invalid spline
+  LRSplineVolume() : knot_tol_(1.0e-8) {}
+
+  // Copy constructor
+  LRSplineVolume(const LRSplineVolume& rhs);
+
+  // Assignment
+  LRSplineVolume& operator=(const LRSplineVolume& rhs);
+
+  // Swap contents with another LRSplineVolume
+  void swap(LRSplineVolume& rhs);
+
+  virtual ~LRSplineVolume() {}
+
+  // ----------------------------------------------------
+  // --------------- INHERITED FUNCTIONS ----------------
+  // ----------------------------------------------------
+
+  // inherited from Streamable
+  virtual void read (std::istream& is);
+  virtual void write (std::ostream& os) const;
+
+  // inherited from GeomObject
+  virtual BoundingBox boundingBox() const;
+  virtual int dimension() const;
+  virtual ClassType instanceType() const;
+  static ClassType classType()
+  { return Class_LRSplineVolume; }
+  virtual LRSplineVolume* clone() const
+  { return new LRSplineVolume(*this); }
+
+  // inherited from ParamVolume
+  // The tangent cone is computed from the full tensor product volume,
+  // which may be expensive.
+  virtual DirectionCone tangentCone(int pardir) const;
+
+  virtual const Array<double,6> parameterSpan() const;
+
+  virtual void point(Point& pt, double upar, double vpar, double wpar) const;
+
+  virtual void point(std::vector<Point>& pts, 
+		     double upar, double vpar, double wpar,
+		     int derivs,
+		     bool u_from_right = true,
+		     bool v_from_right = true,
+		     bool w_from_right = true,
+		     double resolution = 1.0e-12) const;
+
+  virtual double nextSegmentVal(int dir, double par, bool forward, 
+				double tol) const;
+
+  // The closest point is computed on the full tensor product volume,
+  // which may be expensive.
+  virtual void closestPoint(const Point& pt,
+			    double&        clo_u,
+			    double&        clo_v,
+			    double&        clo_w,
+			    Point&         clo_pt,
+			    double&        clo_dist,
+			    double         epsilon,
+			    double   *seed = 0) const;
+
+  // Not implemented
+  virtual void reverseParameterDirection(int pardir);
+
+  // Not implemented
+  virtual void swapParameterDirection(int pardir1, int pardir2);
+
+  virtual void translate(const Point& vec);
+
+  // ----------------------------------------------------
+  // --------------- QUERY FUNCTIONS --------------------
+  // ----------------------------------------------------
+  // Polynomial degree in the given direction
+  int degree(Direction3D d) const;
+
+  // Start and end of the parameter domain in the given direction
+  double paramMin(Direction3D d) const { return mesh_.minParam(d); }
+  double paramMax(Direction3D d) const { return mesh_.maxParam(d); }
+
+  const Mesh3D& mesh() const { return mesh_; }
+
+  int numBasisFunctions() const { return (int)bsplines_.size(); }
+  int numElements() const { return (int)emap_.size(); }
+
+  BSplineMap::const_iterator basisFunctionsBegin() const {return bsplines_.begin();}
+  BSplineMap::const_iterator basisFunctionsEnd()   const {return bsplines_.end();}
+  ElementMap::const_iterator elementsBegin() const { return emap_.begin();}
+  ElementMap::const_iterator elementsEnd()   const { return emap_.end();}
+
+  // The element containing a given parameter triple.  On element boundaries,
+  // the element above the parameter is returned unless the parameter is at
+  // the end of the domain.
+  Element3D* coveringElement(double u, double v, double w) const;
+
+  // Tolerance for equality of knots
+  double getKnotTol() const { return knot_tol_; }
+
+  // Returns 'true' if the underlying mesh is a regular grid, i.e. the
+  // volume is a tensor product spline volume.
+  bool isFullTensorProduct() const;
+
+  // Return the full tensor product representation of the volume as a
+  // SplineVolume.  It is the user's responsibility to delete it.
+  SplineVolume* convertToSplineVolume() const;
+
+  // ----------------------------------------------------
+  // --------------- EDIT FUNCTIONS ---------------------
+  // ----------------------------------------------------
+  // Insert a single refinement in the mesh, see Refinement3D for the 
+  // meaning of the parameters.  If 'absolute' is set to 'false' (default),
+  // the refinement will _increment_ the multiplicity of the involved
+  // mesh plane by 'mult'.  If set to 'true', the multiplicity is _set_ to
+  // 'mult' (however, if this results in a _decrease_ of multiplicity
+  // anywhere, the method will throw an error instead).  The method will
+  // also throw if the resulting multiplicity would exceed degree+1.
+  void refine(Direction3D d, double fixed_val, double start1, double end1,
+	      double start2, double end2, int mult = 1, bool absolute = false);
+
+  // Same function as previous, but information about the refinement is
+  // passed along in a 'Refinement3D' structure.
+  void refine(const Refinement3D& ref, bool absolute = false);
+
+  // Insert a batch of refinements simultaneously.  The B-splines are
+  // split and the elements are recomputed once for the entire batch.
+  void refine(const std::vector<Refinement3D>& refs, bool absolute = false);
+
+  // Convert the volume to its full tensor product spline representation
+  // (NB: not reversible!)
+  void expandToFullTensorProduct();
+
+ private:
+  double knot_tol_;       // Tolerance for when to consider two knot values
+                          // distinct rather than a single one of higher
+                          // multiplicity
+
+  Mesh3D mesh_;           // Mesh topology, multiplicities and knot values
+
+  BSplineMap bsplines_;   // Map of the B-spline functions
+
+  ElementMap emap_;       // Map of the elements
+
+  void initFromSplineVolume(const SplineVolume& vol);
+
+  // Update the mesh according to a refinement.  Planes which are new to the
+  // mesh cause the knot indices of the B-splines to be shifted.
+  void refineMesh(const Refinement3D& ref, bool absolute);
+
+  // Split B-splines that are traversed by mesh planes not present in their
+  // local knot vectors, starting from the functions in 'work'.
+  void splitBasisFunctions(std::vector<LRBSpline3D*>& work);
+
+  // Insert a B-spline into the map.  If a B-spline with the same knots
+  // exists already, the coefficient and gamma of 'b' are added to it.
+  // Returns the B-spline stored in the map.
+  LRBSpline3D* insertBasisFunction(std::unique_ptr<LRBSpline3D> b);
+
+  // Locate all elements in the mesh and register the B-spline support
+  void constructElementMap();
+
+  // Find the lower-left-front cell of the element containing a cell
+  void elementCorner(int& i, int& j, int& k) const;
+};
+
+} // end namespace Go
+
+#endif // _LRSPLINEVOLUME_H
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _MESH_3D_H
+#define _MESH_3D_H
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "GoTools/geometry/Streamable.h"
+#include "GoTools/lrsplines3D/Direction3D.h"
+
+namespace Go
+{
+
+// =============================================================================
+/// Box partition of a trivariate parameter domain, the topological
+/// backbone of an LRSplineVolume.  The mesh stores the distinct knot
+/// values in each parameter direction.  For each knot value it keeps
+/// the multiplicity of the mesh plane over every cell of the underlying
+/// tensor grid spanned by the two remaining directions.  A multiplicity
+/// of zero means that the plane is not part of the mesh at that cell.
+/// Cells in a plane with fixed parameter in direction d are indexed by
+/// (i1, i2), where i1 runs along next(d) and i2 along prev(d).
+class Mesh3D : public Streamable
+// =============================================================================
+{
+public:
+  // ---------------------------------------------------------
+  // --- CONSTRUCTORS, READING, WRITING AND SWAP FUNCTIONS ---
+  // ---------------------------------------------------------
+  Mesh3D() {}; // empty mesh
+  Mesh3D(std::istream& is); // read mesh from stream
+
+  /// Construct a full, tensor product mesh from three knot vectors.
+  /// Multiplicities > 1 are expressed by repeated values in the ranges.
+  template<typename Iter>
+  Mesh3D(Iter kx_start, Iter kx_end, Iter ky_start, Iter ky_end,
+	 Iter kz_start, Iter kz_end)
+  {
+    setTensorMesh(XDIR, kx_start, kx_end);
+    setTensorMesh(YDIR, ky_start, ky_end);
+    setTensorMesh(ZDIR, kz_start, kz_end);
+    fillTensorMults();
+  }
+
+  /// Read the mesh from a stream
+  virtual void read (std::istream& is);
+  /// Write the mesh to a stream
+  virtual void write (std::ostream& os) const;
+
+  /// Swap the contents of two meshes
+  void swap(Mesh3D& rhs);
+
+  // -------------------------
+  // --- QUERY FUNCTIONS ---
+  // -------------------------
+  /// Number of distinct knot values in direction 'd'
+  int numDistinctKnots(Direction3D d) const 
+  { 
+    return (int)knotvals_[d].size(); 
+  }
+
+  /// Knot value with index 'ix' in direction 'd'
+  double kval(Direction3D d, int ix) const 
+  { 
+    return knotvals_[d][ix]; 
+  }
+
+  const double* knotsBegin(Direction3D d) const 
+  { 
+    return &knotvals_[d][0]; 
+  }
+
+  const double* knotsEnd(Direction3D d) const 
+  { 
+    return knotsBegin(d) + numDistinctKnots(d); 
+  }
+
+  double minParam(Direction3D d) const 
+  { 
+    return knotvals_[d].front(); 
+  }
+
+  double maxParam(Direction3D d) const 
+  { 
+    return knotvals_[d].back(); 
+  }
+
+  /// Multiplicity of the plane with index 'ix' in direction 'd' at the
+  /// cell (i1, i2) of the plane.
+  int mult(Direction3D d, int ix, int i1, int i2) const
+  {
+    return (int)mults_[d][ix][cellIndex(d, i1, i2)];
+  }
+
+  /// The smallest multiplicity of the plane 'ix' in direction 'd' over
+  /// the cells [start1, end1) x [start2, end2).  If this is positive,
+  /// the plane traverses the whole rectangle.
+  int minMult(Direction3D d, int ix, int start1, int end1,
+	      int start2, int end2) const;
+
+  /// The largest multiplicity of the plane 'ix' in direction 'd' over
+  /// the cells [start1, end1) x [start2, end2).
+  int maxMult(Direction3D d, int ix, int start1, int end1,
+	      int start2, int end2) const;
+
+  /// The largest multiplicity found anywhere in the plane 'ix'
+  int largestMultInPlane(Direction3D d, int ix) const;
+
+  /// Index of the knot value 'par' in direction 'd' within tolerance
+  /// 'eps'.  Returns -1 if no such knot exists.
+  int getKnotIdx(Direction3D d, double par, double eps) const;
+
+  /// Index of the knot interval in direction 'd' containing 'par', so that
+  /// kval(d, ix) <= par < kval(d, ix+1).  A parameter at the end of the domain
+  /// belongs to the last interval.  If 'par' is within 'eps' of a knot,
+  /// it is snapped to the knot value.
+  int knotIntervalFuzzy(Direction3D d, double& par, double eps) const;
+
+  /// Check if all planes covers the entire domain with a constant
+  /// multiplicity
+  bool isTensorProduct() const;
+
+  // ---------------------------
+  // --- EDIT FUNCTIONS ---
+  // ---------------------------
+  /// Insert a new plane with fixed value 'kval' in direction 'd' and
+  /// multiplicity zero everywhere.  The cells of the crossing planes are split
+  /// and inherit the multiplicity of the cell they are split from.  If the
+  /// value exists already, nothing is changed.  The index of the plane is
+  /// returned.
+  int insertPlane(Direction3D d, double kval);
+
+  /// Set the multiplicity of the plane 'ix' in direction 'd' over the cells
+  /// [start1, end1) x [start2, end2).
+  void setMult(Direction3D d, int ix, int start1, int end1,
+	       int start2, int end2, int mult);
+
+  /// Increment the multiplicity of the plane 'ix' in direction 'd' over
+  /// the cells [start1, end1) x [start2, end2).
+  void incrementMult(Direction3D d, int ix, int start1, int end1,
+		     int start2, int end2, int mult);
+
+private:
+  // Distinct knot values in each parameter direction
+  std::vector<double> knotvals_[3];
+
+  // Multiplicities of the mesh planes, one entry for each cell in a plane.
+  // Multiplicities are bounded by the degree + 1, which keeps the per cell
+  // cost at one byte.
+  std::vector<std::vector<unsigned char> > mults_[3];
+
+  int cellIndex(Direction3D d, int i1, int i2) const
+  {
+    return i1 + i2*(numDistinctKnots(next(d)) - 1);
+  }
+
+  int numCells(Direction3D d) const
+  {
+    return (numDistinctKnots(next(d)) - 1)*(numDistinctKnots(prev(d)) - 1);
+  }
+
+  // Set the distinct knots of direction 'd' and remember the multiplicities
+  // of the tensor product mesh in 'tensor_mult_'
+  template<typename Iter>
+  void setTensorMesh(Direction3D d, Iter start, Iter end)
+  {
+    knotvals_[d].clear();
+    tensor_mult_[d].clear();
+    for (Iter it = start; it != end; ++it)
+      {
+	if (knotvals_[d].size() > 0 && knotvals_[d].back() == *it)
+	  ++tensor_mult_[d].back();
+	else
+	  {
+	    knotvals_[d].push_back(*it);
+	    tensor_mult_[d].push_back(1);
+	  }
+      }
+  }
+
+  void fillTensorMults();
+
+  // Only used during construction of a tensor product mesh
+  std::vector<int> tensor_mult_[3];
+};
+
+}; // end namespace Go
+
+#endif // _MESH_3D_H
@@ -41,6 +41,7 @@
 #define PRCELLSTRUCTURE_H
 
 #include "GoTools/utils/Array.h"
+#include "GoTools/utils/KdTree.h"
 using Go::Vector3D;
 #include <vector>
 using std::vector;
@@ -49,13 +50,15 @@ using std::ostream;
 
 /*<PrCellStructure-syntax: */
 
-/** PrCellStructure - Represents a set of points in three dimensions
- * and a cell structure: a 3D grid of cubical cells each with a local
- * list of those points which lie inside it.
- * This allows one to perform various queries, such as finding all points
- * in a ball, very efficiently.
- * Creating the cell structure requires only O(N) operations,
- * where \a N is the number of points.
+/** PrCellStructure - Represents a set of points in three dimensions.
+ * Queries, such as finding all points in a ball or the k nearest
+ * points, are answered by an adaptive kd-tree (Go::KdTree), which
+ * is efficient also for point sets with varying density. Building
+ * the tree requires O(N log N) operations, where \a N is the number
+ * of points. The queries may be run from several threads.
+ * The layout of a 3D grid of cubical cells around the points is kept
+ * for whichCell() and getI(), but the points are not sorted into
+ * the cells.
  */
 class PrCellStructure
 {
@@ -66,9 +69,8 @@ private:
     double min_[3]; // min value in each coordinate
     int ncells_[3]; // number of cells in each coordinate
     double cell_size_; // dimension of cell, each cell is a cube
-    vector<vector<int> > ind_;
-    //VecSimplest(PrIntList) ind_;
     int max_no_cells_;
+    Go::KdTree kdtree_;
 
     void makeCellStructure();
 
@@ -165,12 +167,10 @@ Name:              PrCellStructure
 Syntax:	           @PrCellStructure-syntax
 Keywords:
 Description:       This class represents a set of points in three dimensions
-                   and a cell structure: a 3D grid of cubical cells
-                   each with a local list of those points which lie inside it.
-                   This allows one to perform various queries, such as
-                   finding all points in a ball, very efficiently.
-                   Creating the cell structure requires only O(N) operations,
-                   where $N$ is the number of points.
+                   and a kd-tree over them. This allows one to perform
+                   various queries, such as finding all points in a ball,
+                   very efficiently. Building the tree requires
+                   O(N log N) operations, where $N$ is the number of points.
 Member functions:
 
 Constructors:
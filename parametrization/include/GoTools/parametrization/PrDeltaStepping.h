@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _PRDELTASTEPPING_H
+#define _PRDELTASTEPPING_H
+
+#include "GoTools/parametrization/PrOrganizedPoints.h"
+#include <vector>
+
+
+/** PrDeltaStepping - Shortest paths along the edges of a graph by the
+ * delta-stepping algorithm of Meyer and Sanders. The tentative
+ * distances are kept in buckets of width delta instead of a heap.
+ * All nodes in the current bucket are settled together: first the
+ * light edges (not longer than delta) are relaxed until the bucket
+ * stays empty, then the heavy edges of the settled nodes. The edges of
+ * a bucket are scanned in parallel when OpenMP is enabled and the
+ * bucket is large enough.
+ *
+ * The edge lengths are the euclidean distances between the nodes, as
+ * in Dijkstra. By default edges between two boundary nodes are not
+ * used, corresponding to the prohibitive length Dijkstra gives them.
+ *
+ * Distances from many sources are computed by computeDistances(),
+ * which handles the sources concurrently, one source per thread.
+ */
+class PrDeltaStepping
+{
+public:
+  /// Constructor
+  PrDeltaStepping();
+
+  /// Destructor
+  ~PrDeltaStepping();
+
+  /// Set the graph to run the algorithm on, and store its edges.
+  /// Must be run before 'initialize()'. The graph must not change
+  /// while this object is used.
+  /// \param graph the graph
+  /// \param useBoundaryEdges if false, edges between two boundary
+  ///        nodes are left out
+  void setGraph(const PrOrganizedPoints* graph, bool useBoundaryEdges = false);
+
+  /// Set the bucket width. If delta <= 0, three times the mean edge
+  /// length is used, which is the default.
+  void setDelta(double delta);
+
+  /// The bucket width in use
+  double getDelta() const
+  {
+    return delta_;
+  }
+
+  /// Use several threads, if available. Default is true.
+  void setMultiCore(bool multiCore)
+  {
+    multiCore_ = multiCore;
+  }
+
+  /// Initialize internal data structures, all distances are set to a
+  /// large number. Must be done after 'setGraph()' has been called.
+  void initialize();
+
+  /// Set a 'source' for the algorithm. This is a node for which the
+  /// associated minimum distance is known. At least one source must
+  /// be set for the algorithm to work properly.
+  /// \param node_idx the index of the node to be designated as a source
+  /// \param dist the distance at this node (typically 0).
+  void setSource(int node_idx, double dist = 0);
+
+  /// Run the algorithm. Compute the associated distance for all nodes
+  /// in the graph.
+  void run();
+
+  /// Get the distance associated with the node 'node_idx'. Does not
+  /// give a valid answer until the algorithm has been run().
+  double getDistance(int node_idx) const
+  {
+    return ws_.dist[node_idx];
+  }
+
+  /// All distances computed by run()
+  const std::vector<double>& getDistances() const
+  {
+    return ws_.dist;
+  }
+
+  /// The distance given to nodes which can not be reached
+  double getLargeDistance() const
+  {
+    return large_distance_;
+  }
+
+  /// Compute the distances from each of the given sources to all
+  /// nodes of the graph. The sources are handled concurrently.
+  /// \param sources the source nodes
+  /// \param distances on output distances[i][j] is the distance
+  ///        from sources[i] to node j
+  void computeDistances(const std::vector<int>& sources,
+			std::vector<std::vector<double> >& distances) const;
+
+private:
+  // Tentative distances and buckets for one run
+  struct Workspace
+  {
+    std::vector<double> dist;
+    std::vector<int> bucketIdx;   // Bucket of each node, -1 if none
+    std::vector<std::vector<int> > buckets;
+    std::vector<int> frontier;
+    std::vector<int> settled;
+    std::vector<std::vector<std::pair<int, double> > > requests;
+  };
+
+  int nn_;
+  std::vector<int> edgeStart_;     // Edges of the graph in CSR form
+  std::vector<int> edgeNode_;
+  std::vector<double> edgeLength_;
+  double meanLength_;
+  double delta_;
+  double large_distance_;
+  bool multiCore_;
+  Workspace ws_;
+
+  void reset(Workspace& ws) const;
+  void relax(Workspace& ws, int node, double dist) const;
+  void relaxEdges(Workspace& ws, const std::vector<int>& nodes,
+		  bool light, bool parallel) const;
+  void solve(Workspace& ws, bool parallel) const;
+};
+
+
+#endif // _PRDELTASTEPPING_H
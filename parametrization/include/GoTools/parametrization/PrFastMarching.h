@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _PRFASTMARCHING_H
+#define _PRFASTMARCHING_H
+
+#include "GoTools/parametrization/PrTriangulation_OP.h"
+#include <vector>
+
+
+/** PrFastMarching - Geodesic distances on a triangulation by the fast
+ * marching method of Kimmel and Sethian. Contrary to Dijkstra, the
+ * distance may be propagated through the triangles and not only along
+ * the edges, which gives a first order approximation of the geodesic
+ * distance on the surface. A node is updated from a triangle when the
+ * two other nodes of the triangle are known, provided the
+ * characteristic direction lies inside the triangle. Otherwise, and
+ * when only one other node is known, the distance is propagated along
+ * the edges. Obtuse triangles are not split, so the distances on
+ * triangulations with many obtuse angles are closer to the Dijkstra
+ * distances.
+ *
+ * Distances from many sources are computed by computeDistances(),
+ * which handles the sources concurrently, one source per thread.
+ */
+class PrFastMarching
+{
+public:
+  /// Constructor
+  PrFastMarching();
+
+  /// Destructor
+  ~PrFastMarching();
+
+  /// Set the triangulation to run the algorithm on, and store its
+  /// nodes and triangles. Must be run before 'initialize()'.
+  void setTriangulation(const PrTriangulation_OP* triang);
+
+  /// Use several threads for computeDistances(), if available.
+  /// Default is true.
+  void setMultiCore(bool multiCore)
+  {
+    multiCore_ = multiCore;
+  }
+
+  /// Initialize internal data structures, all distances are set to a
+  /// large number. Must be done after 'setTriangulation()' has been
+  /// called.
+  void initialize();
+
+  /// Set a 'source' for the algorithm. This is a node for which the
+  /// associated minimum distance is known. At least one source must
+  /// be set for the algorithm to work properly.
+  /// \param node_idx the index of the node to be designated as a source
+  /// \param dist the distance at this node (typically 0).
+  void setSource(int node_idx, double dist = 0);
+
+  /// Run the algorithm. Compute the associated distance for all nodes
+  /// in the triangulation.
+  void run();
+
+  /// Get the distance associated with the node 'node_idx'. Does not
+  /// give a valid answer until the algorithm has been run().
+  double getDistance(int node_idx) const
+  {
+    return ws_.dist[node_idx];
+  }
+
+  /// All distances computed by run()
+  const std::vector<double>& getDistances() const
+  {
+    return ws_.dist;
+  }
+
+  /// Compute the distances from each of the given sources to all
+  /// nodes of the triangulation. The sources are handled concurrently.
+  /// \param sources the source nodes
+  /// \param distances on output distances[i][j] is the distance
+  ///        from sources[i] to node j
+  void computeDistances(const std::vector<int>& sources,
+			std::vector<std::vector<double> >& distances) const;
+
+private:
+  // State of one run
+  struct Workspace
+  {
+    std::vector<double> dist;
+    std::vector<char> alive;
+    std::vector<std::pair<double, int> > heap;   // Binary heap,
+  };                                             // smallest on top
+
+  int nn_;
+  std::vector<Vector3D> nodes_;
+  std::vector<int> triangles_;     // Three nodes for each triangle
+  std::vector<int> triStart_;      // Triangles around each node,
+  std::vector<int> triIdx_;        // in CSR form
+  double large_distance_;
+  bool multiCore_;
+  Workspace ws_;
+
+  void reset(Workspace& ws) const;
+  void insert(Workspace& ws, int node, double dist) const;
+  void solve(Workspace& ws) const;
+  double update(const Workspace& ws, int node, int n1, int n2) const;
+};
+
+
+#endif // _PRFASTMARCHING_H
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _PRMULTIGRID_H
+#define _PRMULTIGRID_H
+
+#include "GoTools/utils/CsrMatrix.h"
+#include "GoTools/utils/SparsePreconditioner.h"
+#include <vector>
+
+
+/** PrMultigrid - Multilevel solver for the equation systems of the
+ * interior parametrization. The hierarchy is built by vertex
+ * decimation of the graph of the matrix: a maximal independent set
+ * of nodes is kept at the coarser level, and each removed node is
+ * interpolated from its kept neighbours using the weights of its
+ * row. The coarse matrices are the Galerkin products R*A*P with
+ * R = P^T, where small entries are lumped onto the diagonal to limit
+ * the growth of the stencils. The coarsest system is solved directly,
+ * or by Jacobi iterations if coarsening stagnates before reaching the
+ * requested size.
+ *
+ * The class is a Go::SparsePreconditioner, apply() performs one
+ * V-cycle with damped Jacobi smoothing. nestedIteration() computes a
+ * start vector by solving at the coarsest level and prolongating and
+ * smoothing upwards. Smoothing and the transfer between levels run in
+ * parallel when OpenMP is enabled.
+ */
+class PrMultigrid : public Go::SparsePreconditioner
+{
+public:
+  /// Constructor. Build the hierarchy.
+  /// \param A the system matrix, typically with unit diagonal and the
+  ///        negative weights as off-diagonal entries
+  /// \param numSmooth number of pre and post smoothing steps
+  /// \param coarseSize maximum size of the coarsest system
+  PrMultigrid(const Go::CsrMatrix& A, int numSmooth = 2, int coarseSize = 500);
+
+  /// Empty destructor
+  virtual ~PrMultigrid();
+
+  /// Apply one V-cycle to each of num_rhs vectors, starting from zero.
+  virtual void apply(const double* r, double* s, int num_rhs = 1) const;
+
+  /// Number of unknowns at the finest level
+  virtual int size() const
+  {
+    return nn_;
+  }
+
+  /// Compute an approximate solution of A*x = b by nested iteration.
+  /// The right hand sides are restricted to the coarsest level where
+  /// the system is solved. The solution is prolongated level by level
+  /// and improved by one V-cycle at each level.
+  void nestedIteration(const double* b, double* x, int num_rhs = 1) const;
+
+  /// Number of levels in the hierarchy, including the coarsest level
+  int numLevels() const
+  {
+    return (int)levels_.size() + 1;
+  }
+
+private:
+  // Transfer operators between a level and the next coarser level
+  struct Level
+  {
+    Go::CsrMatrix A;              // Matrix at this level
+    std::vector<double> invDiag;  // Inverse diagonal, for smoothing
+    int numCoarse;                // Number of unknowns at coarser level
+    std::vector<int> pStart;      // Prolongation, one row for each
+    std::vector<int> pCol;        // unknown at this level
+    std::vector<double> pVal;
+    std::vector<int> rStart;      // Restriction P^T, one row for each
+    std::vector<int> rCol;        // unknown at the coarser level
+    std::vector<double> rVal;
+  };
+
+  int nn_;
+  int numSmooth_;
+  double damping_;
+  std::vector<Level> levels_;
+  Go::CsrMatrix coarseA_;                        // Coarsest matrix
+  std::vector<double> coarseInvDiag_;
+  std::vector<std::vector<double> > coarseLU_;   // LU factorized
+  std::vector<int> coarsePerm_;                  // coarsest matrix
+
+  void vcycle(int level, const double* r, double* s) const;
+  void smooth(const Level& lev, const double* r, double* s, int nmb) const;
+  void prolongate(const Level& lev, const double* xc, double* x) const;
+  void restrictVector(const Level& lev, const double* x, double* xc) const;
+  void coarseSolve(const double* r, double* s) const;
+};
+
+
+#endif // _PRMULTIGRID_H
@@ -79,6 +79,16 @@ protected:
   vector< vector<double> > allWeights_;
   vector< vector<int> >    allNeighbours_;
 
+  // Weights in compressed row storage. The weights of node i are
+  // csrWeights_[k], with neighbours csrNeighbours_[k], for
+  // csrStart_[i] <= k < csrStart_[i+1].
+  vector<int>              csrStart_;
+  vector<int>              csrNeighbours_;
+  vector<double>           csrWeights_;
+
+  bool                     multiCore_;
+  bool                     multilevel_;
+
 // PRIVATE METHODS
 
 // Used for parametrizing the interior.
@@ -89,6 +99,14 @@ protected:
 
   virtual bool makeWeights(int i) = 0;
 
+  /// A new, default constructed parametrizer of the same kind. Used
+  /// for computing the weights in parallel, one instance per thread.
+  /// If NULL is returned the weights are computed sequentially.
+  virtual PrParametrizeInt* newInstance() const
+  {
+      return 0;
+  }
+
   const vector< vector<double> >& getAllWeights() const
   {
       return allWeights_;
@@ -115,6 +133,30 @@ public:
   /// Set tolerance for Bi-CGSTAB.
   void setBiCGTolerance(double tolerance = 1.0e-6) {tolerance_ = tolerance;}
 
+  /// Compute weights and solve the equation systems in parallel if
+  /// OpenMP is available. Default is true.
+  void setMultiCore(bool multiCore = true) {multiCore_ = multiCore;}
+
+  /// Solve the equation systems of parametrize() by the multilevel
+  /// method in PrMultigrid, which converges independently of the size
+  /// of the mesh. With the start vector PrBARYCENTRE the start vector is
+  /// computed from the coarse levels. Default is false.
+  void setMultilevel(bool multilevel = true) {multilevel_ = multilevel;}
+
+  /// Compute the weights of all nodes, or only of the interior nodes,
+  /// and store them in compressed row storage. Rows of nodes that
+  /// are skipped are empty.
+  void makeWeightMatrix(bool interiorOnly);
+
+  /// Row start indices of the weight matrix, size getNumNodes()+1
+  const vector<int>& getWeightRowStart() const {return csrStart_;}
+
+  /// Neighbour node indices of the weight matrix
+  const vector<int>& getWeightNeighbours() const {return csrNeighbours_;}
+
+  /// Weights in the weight matrix
+  const vector<double>& getWeightValues() const {return csrWeights_;}
+
   /// Parametrize the given planar graph.
   bool parametrize();
 
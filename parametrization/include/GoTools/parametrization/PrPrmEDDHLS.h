@@ -51,6 +51,10 @@ class PrPrmEDDHLS : public PrParametrizeInt
 {
 protected:
   virtual bool makeWeights(int i);
+  virtual PrParametrizeInt* newInstance() const
+  {
+      return new PrPrmEDDHLS();
+  }
 
 public:
   /// Default constructor 
@@ -50,6 +50,10 @@ class PrPrmExperimental : public PrParametrizeInt
 protected:
 
   virtual bool makeWeights(int i);
+  virtual PrParametrizeInt* newInstance() const
+  {
+      return new PrPrmExperimental();
+  }
 
 public:
   /// Default constructor 
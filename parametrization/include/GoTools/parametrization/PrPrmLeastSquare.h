@@ -53,6 +53,10 @@ protected:
 
   virtual
   bool       makeWeights(int i);
+  virtual PrParametrizeInt* newInstance() const
+  {
+      return new PrPrmLeastSquare();
+  }
 
 public:
   /// Default constructor
@@ -60,6 +60,10 @@ class PrPrmMeanValue : public PrParametrizeInt
 protected:
 
   virtual bool makeWeights(int i);
+  virtual PrParametrizeInt* newInstance() const
+  {
+      return new PrPrmMeanValue();
+  }
 
 public:
   /// Default constructor
@@ -56,6 +56,10 @@ protected:
   std::vector<double> len_;
 
   virtual bool makeWeights(int i);
+  virtual PrParametrizeInt* newInstance() const
+  {
+      return new PrPrmShpPres();
+  }
   bool         localParam(int i);
 
 public:
@@ -66,6 +66,10 @@ private:
 			 std::vector<double>& weights);
   bool       localParamXYZ(int i);
   bool       localParamUV(int i);
+  virtual PrParametrizeInt* newInstance() const
+  {
+      return new PrPrmSurface();
+  }
 
 public:
   /// Default constructor
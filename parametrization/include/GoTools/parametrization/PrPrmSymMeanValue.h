@@ -52,6 +52,10 @@ class PrPrmSymMeanValue : public PrParametrizeInt
 {
 protected:
     virtual bool makeWeights(int i);
+    virtual PrParametrizeInt* newInstance() const
+    {
+        return new PrPrmSymMeanValue();
+    }
     double  tanThetaOverTwo(Vector3D& a, Vector3D& b, Vector3D& c);
 
 public:
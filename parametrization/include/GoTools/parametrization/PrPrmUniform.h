@@ -53,6 +53,10 @@ private:
 
   virtual
   bool       makeWeights(int i);
+  virtual PrParametrizeInt* newInstance() const
+  {
+      return new PrPrmUniform();
+  }
 
 public:
   /// Default constructor
@@ -50,6 +50,10 @@ class PrPrmWachspress : public PrParametrizeInt
 {
 protected:
     virtual bool makeWeights(int i);
+    virtual PrParametrizeInt* newInstance() const
+    {
+        return new PrPrmWachspress();
+    }
     double  tanThetaOverTwo(Vector3D& a, Vector3D& b, Vector3D& c);
 
 public:
@@ -42,6 +42,7 @@
 
 #include "GoTools/qualitymodule/ModelQuality.h"
 #include <vector>
+#include <set>
 
 namespace Go
 {
@@ -61,9 +62,29 @@ namespace Go
 	    virtual
 	    ~FaceSetQuality();
 
-	    // Add model info
+	    // Add model info. The modifications registered in the model
+	    // are cleared, see updateResults()
 	    void attach(shared_ptr<SurfaceModel> sfmodel);
 
+	    /// Run the per face work of the tests in parallel threads.
+	    /// Only active if GoTools is compiled with OpenMP. The results
+	    /// are identical to the results of the sequential tests.
+	    void setMultiCore(bool multi_core)
+	    {
+		multi_core_ = multi_core;
+	    }
+
+	    /// Run all tests. The results are stored in the result
+	    /// container, see getResults(), and are returned by later
+	    /// calls to the individual tests. Tests that may modify the
+	    /// model are run last.
+	    /// \param sliver_thickness thickness used by sliverSurfaces()
+	    /// \param sliver_factor factor used by sliverSurfaces()
+	    /// \param knot_tol tolerance used by indistinctKnots()
+	    void performAllTests(double sliver_thickness,
+				 double sliver_factor = 2.0,
+				 double knot_tol = 1.0e-8);
+
 	    virtual
 	    void degenSurfaces(std::vector<shared_ptr<ParamSurface> >& deg_sfs);
 
@@ -180,10 +201,54 @@ namespace Go
 		return model_;
 	      }
 
-	    
+	    /// Update the results after the model has been modified. By
+	    /// default all results are reset, and the tests are rerun for
+	    /// the complete model the next time they are called.
+	    /// If registered_only is set, the modifications registered in
+	    /// the model are trusted, see SurfaceModel::markModified().
+	    /// Tests handling one face at a time are then rerun for the
+	    /// modified faces and their neighbours only, while the other
+	    /// tests are reset. In both cases the registered modifications
+	    /// are cleared.
+	    /// \param registered_only All modifications of the model since
+	    ///        the results were computed are registered in the model
+	    void updateResults(bool registered_only = false);
 
 	private:
 	    shared_ptr<SurfaceModel> model_;
+	    bool multi_core_;  // Run the per face work in parallel
+
+	    // Faces to check again for each test, used if update_pending_
+	    // is set for the test
+	    std::vector<std::set<shared_ptr<ftSurface> > > update_faces_;
+	    std::vector<bool> update_pending_;
+
+	    // The faces of the stored results of each test, and the
+	    // number of entries belonging to each face. Two entries
+	    // per test as some tests store two kinds of results. The
+	    // shared pointers prevent that a removed face is confused
+	    // with a new face at the same address.
+	    std::vector<std::vector<std::pair<shared_ptr<ftSurface>, int> > > result_layout_;
+
+	    // The minimum curvature radius of each face
+	    std::vector<std::pair<shared_ptr<PointOnCurve>, double> > cv_face_min_;
+	    std::vector<std::pair<shared_ptr<ftPoint>, double> > sf_face_min_;
+
+	    // Whether the stored results of a test may be updated for
+	    // the modified faces only
+	    bool partialUpdate(testSuite test, double tol);
+
+	    // Prepare a test. Fetch the indices of the faces to check and
+	    // flag them in checked. All faces are checked if update is
+	    // not set, and the stored results are reset.
+	    void selectFaces(testSuite test, double tol, bool update,
+			     std::vector<int>& faces, std::vector<int>& checked);
+
+	    std::vector<std::pair<shared_ptr<ftSurface>, int> >&
+	    resultLayout(testSuite test, int idx = 0)
+	    {
+		return result_layout_[2*test+idx];
+	    }
 	};
 
 } // namespace Go
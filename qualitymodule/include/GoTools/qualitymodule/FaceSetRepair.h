@@ -95,7 +95,10 @@ namespace Go
     void gapTrimming(std::vector<std::pair<ftEdge*, ftEdge*> >& pos_discont,
 		     double epsge, bool update_iso);
 
-    void improveVertexPos(shared_ptr<Vertex> vx, double epsge);
+    // Move the vertex to a better position. The vertex is appended to
+    // modified, to be registered in the model by the caller
+    void improveVertexPos(shared_ptr<Vertex> vx, double epsge,
+			  std::vector<Vertex*>& modified);
 
     void getBoundaryEdges(ftEdge *e1, std::vector<ftEdge*>& edges, double epsge);
 
@@ -209,6 +209,7 @@ class FaceConnectivityUtils
   //=======================================================================
   {
     vec.clear();
+    std::set<edgeType*> stored;
     for (size_t i=0; i<faces.size(); ++i)
       {
 	std::vector<shared_ptr<edgeType> > start_edges = faces[i]->startEdges();
@@ -225,14 +226,12 @@ class FaceConnectivityUtils
 		      {
 			// A continuity issue
 			// Check if this instance is stored already
-			size_t r;
-			for (r=0; r<vec.size(); ++r)
+			if (stored.find(e) == stored.end() &&
+			    stored.find(e->twin()) == stored.end())
 			  {
-			    if (vec[r] == e || vec[r] == e->twin())
-			      break;
+			    vec.push_back(e);   // Only one edge in a twin pair is stored
+			    stored.insert(e);
 			  }
-			if (r == vec.size())
-			  vec.push_back(e);   // Only one edge in a twin pair is stored
 		      }
 		  }
 		
@@ -43,9 +43,11 @@
 
 
 #include "GoTools/trivariate/SplineVolume.h"
+#include "GoTools/creators/SparseGramMatrix.h"
 
 #include <memory>
 #include <vector>
+#include <utility>
 
 
 
@@ -180,7 +182,7 @@ namespace Go
 
     /// Storage of the equation system.
     int nmb_free_;     // Number of free variables in equation system
-    std::vector<double> gmat_;       // Matrix at left side of equation system
+    SparseGramMatrix gmat_;          // Matrix at left side of equation system
     std::vector<double> gright_;     // Right side of equation system
     std::vector<int> pivot_;         // Array giving the position of the free coefficients
 
@@ -229,6 +231,14 @@ namespace Go
     // Add contributions to equation system for least squares approximation
     void addLeastSquares();
 
+    // Add the contribution of one point to the equation system for least
+    // squares approximation, given the B-spline tensor products in the point.
+    // Matrix entries outside the pattern of gmat_ can not be inserted in a
+    // parallel region, they are appended to missing instead
+    void addLeastSquaresPoint(int pt_cnt, const std::vector<double>& tp_basis,
+			      int left0, int left1, int left2,
+			      std::vector<std::pair<std::pair<int,int>, double> >* missing = 0);
+
     // Add contribution to equation system for smoothness optimizations, non-rational case
     void addOptimizeNonrational();
 
@@ -813,6 +813,32 @@ public:
 			const std::vector< double > &param_w,
 			std::vector< double > &points) const;
 
+    /// Evaluate points and derivatives up to a given order on an entire
+    /// grid. The grid is evaluated by sum factorization, i.e. the
+    /// coefficients are contracted with the precomputed basis values in
+    /// one parameter direction at a time, and the isosurfaces in the
+    /// third parameter direction are evaluated in parallel when OpenMP
+    /// is enabled.
+    /// \param param_u parameter values in the first parameter direction
+    /// \param param_v parameter values in the second parameter direction
+    /// \param param_w parameter values in the third parameter direction
+    /// \param derivs number of derivatives to compute, typically 0, 1 or 2
+    /// \param pts_and_derivs upon function return, the points and
+    ///                       derivatives with the first parameter running
+    ///                       fastest. For each point there are
+    ///                       (derivs+1)*(derivs+2)*(derivs+3)/6 entries
+    ///                       of size dimension(), ordered as in point():
+    ///                       position, d/du, d/dv, d/dw, d2/dudu,
+    ///                       d2/dudv, d2/dudw, d2/dvdv, d2/dvdw, d2/dwdw,...
+    /// \param evaluate_from_right specifies directional derivatives,
+    ///                            true=right, false=left
+    void gridEvaluator (const std::vector< double > &param_u,
+			const std::vector< double > &param_v,
+			const std::vector< double > &param_w,
+			int derivs,
+			std::vector< double > &pts_and_derivs,
+			bool evaluate_from_right = true) const;
+
     /// Evaluate positions and first derivatives of all basis values in a given parameter tripple
     /// For non-rationals this is an interface to BsplineBasis::computeBasisValues 
     /// where the basis values in each parameter direction are multiplied to 
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _VOLUMEAPPROX_H_
+#define _VOLUMEAPPROX_H_
+
+#include "GoTools/trivariate/SplineVolume.h"
+#include <vector>
+
+namespace Go
+{
+
+/// This class approximates scattered trivariate data, typically scalar
+/// measurements (u,v,w,f), by a SplineVolume using multilevel B-spline
+/// approximation (MBA).  Each level adds an MBA correction of the current
+/// residuals.  Between the levels, the knot intervals containing points
+/// outside the tolerance are halved, so the lattice is refined where the
+/// data requires it.  The points are bucketed by element at each level and
+/// the contributions are accumulated element by element, in parallel if
+/// OpenMP is available.
+
+class VolumeApprox
+{
+ public:
+  /// Constructor given a parameterized point set
+  /// \param points Parameterized point set given as (u1,v1,w1,f1, u2,v2,w2,f2, ...)
+  ///               The length of the array is (3+dim)x(the number of points).
+  ///               The points are referenced, not copied, and must persist
+  ///               while the approximation runs.
+  /// \param dim    The dimension of the data values
+  /// \param epsge  Requested approximation accuracy
+  /// \param order  Polynomial order of the volume in all parameter directions
+  VolumeApprox(const std::vector<double>& points, int dim, double epsge,
+	       int order = 4);
+
+  /// Set the parameter domain of the volume.  By default the bounding box
+  /// of the parameter values is used.
+  void setDomain(double umin, double umax, double vmin, double vmax,
+		 double wmin, double wmax);
+
+  /// Set the number of coefficients in each parameter direction of the
+  /// initial lattice, default is the polynomial order (a single element).
+  void setInitialCoefs(int ncoef_u, int ncoef_v, int ncoef_w);
+
+  /// Set the number of MBA updates on each lattice before the accuracy
+  /// is checked and the lattice refined (default 2).  Repeated updates
+  /// reduce the residual on a given lattice, and thereby the refinement
+  /// needed to meet the tolerance.
+  void setMBAiter(int nmb_iter)
+  {
+    mba_iter_ = std::max(nmb_iter, 1);
+  }
+
+  /// Enable or disable parallel accumulation (default on).
+  void setMultiCore(bool multi_core)
+  {
+    multi_core_ = multi_core;
+  }
+
+  /// Run the approximation and fetch the approximating volume.
+  /// \retval maxdist the maximum distance between the volume and the data
+  /// \retval avdist the average distance between the volume and the data
+  /// \retval nmb_out_eps the number of points outside the tolerance
+  /// \param max_iter maximum number of refinement levels
+  /// \return the approximating volume
+  shared_ptr<SplineVolume> getApproxVol(double& maxdist, double& avdist,
+					int& nmb_out_eps, int max_iter = 6);
+
+ private:
+  const std::vector<double>& points_;
+  int dim_;
+  int nmb_pts_;
+  double aepsge_;
+  int order_;
+  int init_ncoef_[3];
+  double domain_[6];
+  int mba_iter_;
+  bool multi_core_;
+
+  shared_ptr<SplineVolume> vol_;
+
+  // Point indices sorted element by element, and the start of each element
+  // in 'perm_'.  Elements are numbered by their knot interval indices.
+  std::vector<int> perm_;
+  std::vector<int> elem_start_;
+
+  // Sort the points into the elements of the current volume
+  void sortInElements();
+
+  // Traverse all points and compute the residuals.  If 'update' is true,
+  // the MBA correction of the residuals is added to the volume.  The
+  // knot intervals containing points outside the tolerance are flagged
+  // in 'refine_flag'.
+  void traversePoints(bool update, double& maxdist, double& avdist,
+		      int& nmb_out_eps, std::vector<char> refine_flag[]);
+
+  // Halve all flagged knot intervals.  Returns false if no refinement was
+  // performed.
+  bool refineVolume(const std::vector<char> refine_flag[]);
+};
+
+} // namespace Go
+
+#endif // _VOLUMEAPPROX_H_
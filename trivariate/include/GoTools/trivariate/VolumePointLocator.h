@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _VOLUMEPOINTLOCATOR_H
+#define _VOLUMEPOINTLOCATOR_H
+
+#include "GoTools/trivariate/SplineVolume.h"
+#include "GoTools/utils/Point.h"
+#include <vector>
+
+
+namespace Go
+{
+
+  /// \brief Locate points in a set of spline volumes, i.e. find the volume
+  /// and the parameter value corresponding to a point in geometry space.
+  ///
+  /// The volumes are split into Bezier elements (knot span boxes), and
+  /// a bounding volume hierarchy is built over the bounding boxes of the
+  /// Bezier coefficients of all elements. A point is located by running
+  /// a Newton iteration starting in the centre of each element whose box
+  /// contains the point. If no volume contains the point, the closest
+  /// point in the volumes is computed instead, starting from the nearest
+  /// elements.
+
+  class GO_API VolumePointLocator
+  {
+  public:
+    /// Constructor
+    /// \param volumes the volumes to search. Empty pointers are allowed, the
+    ///                corresponding index is never returned
+    /// \param tol a point closer than tol to a volume is regarded as lying
+    ///            inside the volume
+    VolumePointLocator(const std::vector<shared_ptr<SplineVolume> >& volumes,
+		       double tol);
+
+    /// Destructor
+    ~VolumePointLocator();
+
+    /// Locate one point
+    /// \param pt the point to locate
+    /// \param vol_idx index of the volume where the point is found, -1 if
+    ///                there are no volumes
+    /// \param par parameter value of the point in the volume, size 3
+    /// \param dist distance between the point and the volume in par
+    /// \return true if the point lies inside a volume, false if the closest
+    ///         point is returned
+    bool locatePoint(const Point& pt, int& vol_idx, double par[],
+		     double& dist) const;
+
+    /// Locate a number of points. The points are distributed over the
+    /// available threads, each thread working on its own copy of the
+    /// volumes. Small batches use fewer threads, a single point is
+    /// located without copying the volumes.
+    /// \param pts the points to locate
+    /// \param vol_idx the volume index for each point, see locatePoint()
+    /// \param par three parameter values for each point
+    /// \param dist the distance to the found position for each point
+    /// \return the number of points not lying inside any volume
+    int locatePoints(const std::vector<Point>& pts,
+		     std::vector<int>& vol_idx,
+		     std::vector<double>& par,
+		     std::vector<double>& dist) const;
+
+    /// Number of Bezier elements in all volumes
+    int nmbElements() const
+    { return (int)elem_vol_.size(); }
+
+  private:
+    struct BVHNode
+    {
+      double box_[6];  // Minimum and maximum in all coordinates
+      int first_;      // Leaf nodes: first entry in elem_order_
+      int nmb_;        // Leaf nodes: number of elements, 0 for inner nodes
+      int child_[2];   // Inner nodes: child nodes
+    };
+
+    std::vector<shared_ptr<SplineVolume> > volumes_;
+    double tol_;
+
+    std::vector<int> elem_vol_;      // Volume index of each element
+    std::vector<double> elem_par_;   // Parameter domain of each element, 6 entries
+    std::vector<double> elem_box_;   // Bounding box of each element, 6 entries
+    std::vector<int> elem_order_;    // Elements ordered by leaf node
+    std::vector<BVHNode> nodes_;     // The root node is the first
+
+    void addElements(int vol_idx);
+
+    int buildNode(int first, int nmb);
+
+    bool locate(const std::vector<shared_ptr<SplineVolume> >& volumes,
+		const Point& pt, int& vol_idx, double par[],
+		double& dist) const;
+
+    bool newton(const SplineVolume& vol, const Point& pt,
+		int elem, double par[], double& dist) const;
+
+    void closest(const std::vector<shared_ptr<SplineVolume> >& volumes,
+		 const Point& pt, int node, int& vol_idx, double par[],
+		 double& dist) const;
+  };
+
+} // namespace Go
+
+#endif // _VOLUMEPOINTLOCATOR_H
@@ -91,10 +91,45 @@ namespace Go
    /// Define the trimmed volume and fetch result
     shared_ptr<ftVolume> fetchOneTrimVol(bool refine_sharp = false);
 
+    /// Compute the boundary status of the elements of a trimmed volume
+    /// fetched from this object and split the elements intersected by the
+    /// trimming shells, see ftVolume::splitElementsByTrimSfs. The elements
+    /// are processed in parallel if multi core is set. The time spent is
+    /// added as a separate stage to the stage times
+    void splitElements(shared_ptr<ftVolume> trimvol, double eps,
+		       std::vector<int>& elem_stat,
+		       std::vector<std::vector<shared_ptr<ftVolume> > >& sub_elem,
+		       std::vector<std::vector<int> >& is_inside);
+
+    /// Relate the faces of the trimming shell to the trimmed volume, and
+    /// split the elements in splitElements, in parallel. Default is
+    /// sequential processing
+    void setMultiCore(bool multi_core)
+    {
+      multi_core_ = multi_core;
+    }
+
+    /// Report progress and the time spent in each stage of the volume
+    /// construction to the given stream. Reporting is stopped by os = 0
+    void setReport(std::ostream* os)
+    {
+      report_ = os;
+    }
+
+    /// Name and time in seconds of each stage of the last volume construction
+    const std::vector<std::pair<std::string, double> >& getStageTimes() const
+    {
+      return stage_time_;
+    }
+
   private:
     shared_ptr<SurfaceModel> model_;
     std::vector<shared_ptr<SurfaceModel> > voids_;
     int material_;
+    bool multi_core_;
+    std::ostream* report_;
+    std::vector<std::pair<std::string, double> > stage_time_;
+    double stage_start_;
     BoundingBox bigbox_;
 
     vector<vector<shared_ptr<ftSurface> > > face_grp_;
@@ -107,6 +142,22 @@ namespace Go
     vector<Point> sf_axis_;  // Only set for rotational surfaces
     vector<Point> sf_centre_;  // Only set for rotational surfaces
 
+    // Start timing of the volume construction
+    void startStages();
+
+    // Register the time spent since the previous stage
+    void endStage(const std::string& stage);
+
+    // Find the relation between one face of the trimming shell and
+    // the volume to trim
+    void faceVolumeRelation(shared_ptr<ftSurface> face,
+			    shared_ptr<ParamVolume> vol,
+			    std::vector<shared_ptr<ParamSurface> >& vol_sfs,
+			    std::vector<std::vector<double> >& knots,
+			    std::vector<std::pair<shared_ptr<ftSurface>, shared_ptr<ParamSurface> > >& side_sfs,
+			    double eps, int& boundary, int& constdir,
+			    double& constpar, bool& swapped);
+
     bool identifyBoundaryFaces(std::vector<std::pair<shared_ptr<ftSurface>, shared_ptr<ParamSurface> > >& side_sfs);
 
     void extractMaxSet(std::vector<shared_ptr<ftSurface> >& bd_faces,
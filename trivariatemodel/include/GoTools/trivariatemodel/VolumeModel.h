@@ -48,6 +48,7 @@ namespace Go
 {
   class IntResultsModel;
   class GeneralMesh;
+  class VolumePointLocator;
 
   /// \brief A set of volumes including topology information.
 
@@ -111,7 +112,7 @@ namespace Go
 			int nder,     // Number of derivatives to compute, 0=only position
 			std::vector<Point>& der) const;  // Result
 
-  /// Compute one closest point, interface heritage, not implemented
+  /// Compute one closest point. For many points, use locatePoints
   virtual void
     closestPoint(Point& pnt,     // Input point
 		 Point& clo_pnt, // Found closest point
@@ -119,6 +120,23 @@ namespace Go
 		 double clo_par[],   // Parameter value corrsponding to the closest point
 		 double& dist);  // Distance between input point and found closest point
 
+  /// Locate a set of points in the spline volumes of the model. For each
+  /// point, the index of the volume containing it and the corresponding
+  /// parameter value are returned. A point outside the model is projected
+  /// onto the closest volume. The search uses a bounding volume hierarchy
+  /// over the knot span elements of all volumes, and the points are
+  /// processed in parallel. Volumes not representable as spline volumes
+  /// are ignored. The search structure is kept between calls and rebuilt
+  /// when the volumes of the model change. Changes made to a volume
+  /// directly, not through the model, are not detected.
+  /// \param pts the points to locate
+  /// \param vol_idx volume index for each point
+  /// \param par parameter value for each point, 3 values per point
+  /// \param dist distance between each point and the found volume point
+  /// \return the number of points not located inside any volume
+  int locatePoints(const std::vector<Point>& pts, std::vector<int>& vol_idx,
+		   std::vector<double>& par, std::vector<double>& dist) const;
+
   /// Intersection with a line, interface heritage, not implemented. 
   /// Expected output is points, probably one point. Curves 
   /// can occur in special configurations. 
@@ -281,6 +299,11 @@ namespace Go
 
   double approxtol_;
 
+  /// Search structure used in locatePoints, built on demand
+  mutable shared_ptr<VolumePointLocator> locator_;
+  /// The volumes from which locator_ was built
+  mutable std::vector<std::weak_ptr<ParamVolume> > locator_vols_;
+
   /// Local storage of intersection results. Used internally in VolumeModel.
   typedef struct intersection_point 
   {
@@ -324,6 +347,15 @@ namespace Go
 
     void averageVolBoundaries(EdgeVertex* edge);
 
+    /// The point locator for the current volumes
+    shared_ptr<VolumePointLocator> pointLocator() const;
+
+    /// Discard the point locator, the volumes have changed
+    void resetPointLocator()
+    {
+      locator_.reset();
+    }
+
 
   };
 
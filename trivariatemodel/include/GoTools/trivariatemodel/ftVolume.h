@@ -382,6 +382,20 @@ namespace Go
 			       std::vector<shared_ptr<ftVolume> >& sub_elem,
 			       std::vector<int>& is_inside);
 
+    /// Compute the boundary status of all elements in the underlying
+    /// spline volume, see ElementBoundaryStatus, and split the elements
+    /// intersected by the trimming shells, see splitElementByTrimSfs.
+    /// The sub elements and the inside flags are stored per element and
+    /// are empty for elements not intersected by the trimming shells.
+    /// If multi_core is set, the elements are processed in parallel. Each
+    /// thread then works on its own copy of this volume, and the resulting
+    /// sub elements are made to refer to the trimming surfaces of this
+    /// volume afterwards
+    void splitElementsByTrimSfs(double eps, std::vector<int>& elem_stat,
+				std::vector<std::vector<shared_ptr<ftVolume> > >& sub_elem,
+				std::vector<std::vector<int> >& is_inside,
+				bool multi_core = false);
+
     /// Debug
     bool checkBodyTopology();
 
@@ -393,6 +407,10 @@ namespace Go
 
     std::vector<shared_ptr<ftEdge> > missing_edges_;  // Private storage
 
+    /// Copy of this volume not sharing any geometry or topology with
+    /// the current volume
+    shared_ptr<ftVolume> deepCopy() const;
+
     /// Private method to create the boundary shell
     shared_ptr<SurfaceModel> 
       createBoundaryShell(double eps, double tang_eps);